@@ -11,6 +11,8 @@ int main( int argc, char **argv )
        char errorMessage[ MAX_STR_LEN ];
        CmdLineData cmdLineData;
        bool configUploadSuccess = false;
+       bool metaDataUploadSuccess = false;
+       MetaDataStream metaDataStream;
 
        // show title
           // function: printf
@@ -35,6 +37,18 @@ int main( int argc, char **argv )
                 displayConfigData( configDataPtr );
                }
           
+            // check for virtual time switch, overrides config time mode
+            if( cmdLineData.virtualTimeFlag )
+               {
+                configDataPtr->timeModeCode = TIME_VIRTUAL_CODE;
+               }
+
+            // check for time scale switch, overrides config time scale
+            if( cmdLineData.timeScaleFlag )
+               {
+                configDataPtr->timeScale = cmdLineData.timeScale;
+               }
+
             // set config upload success flag
             configUploadSuccess = true;
            }
@@ -51,10 +65,25 @@ int main( int argc, char **argv )
         if( configUploadSuccess 
                     && ( cmdLineData.mdDisplayFlag || cmdLineData.runSimFlag ) )
            {
-            // upload meta data file, check for success
-               // function: getMetaData
-            if( getMetaData( configDataPtr->metaDataFileName, 
-                                                  &metaDataPtr, errorMessage ) )
+            // upload meta data file, compiled files are mapped directly,
+            // text files are parsed on all online cores, check for success
+               // function: isBinaryMetaDataFile, getMetaDataBinary, 
+               //           getMetaDataParallel
+            if( isBinaryMetaDataFile( configDataPtr->metaDataFileName ) )
+               {
+                metaDataUploadSuccess = getMetaDataBinary( 
+                                           configDataPtr->metaDataFileName, 
+                                                  &metaDataPtr, errorMessage );
+               }
+
+            else
+               {
+                metaDataUploadSuccess = getMetaDataParallel( 
+                                           configDataPtr->metaDataFileName, 
+                                               &metaDataPtr, errorMessage, 0 );
+               }
+
+            if( metaDataUploadSuccess )
                {
                 // check meta data display flag
                 if( cmdLineData.mdDisplayFlag )
@@ -84,6 +113,51 @@ int main( int argc, char **argv )
            }
         // end check need for metadata upload
 
+        // check for config success and pipelined run
+        if( configUploadSuccess && cmdLineData.runStreamFlag )
+           {
+            // compiled metadata loads without parsing, 
+            // so run it after upload instead
+               // function: isBinaryMetaDataFile
+            if( isBinaryMetaDataFile( configDataPtr->metaDataFileName ) )
+               {
+                // clear previous metadata, upload, run if successful
+                   // function: clearMetaDataList, getMetaDataBinary, runSim
+                metaDataPtr = clearMetaDataList( metaDataPtr );
+
+                if( getMetaDataBinary( configDataPtr->metaDataFileName, 
+                                                  &metaDataPtr, errorMessage ) )
+                   {
+                    runSim( configDataPtr, metaDataPtr );
+                   }
+
+                else
+                   {
+                    printf( "\nMetadata Upload Error: %s, program aborted\n", 
+                                                                 errorMessage );
+                   }
+               }
+
+            // otherwise, start metadata stream, check for success
+               // function: startMetaDataStream
+            else if( startMetaDataStream( configDataPtr->metaDataFileName, 
+                                          &metaDataStream, errorMessage ) )
+               {
+                // run simulator as processes load
+                   // function: runSimStream
+                runSimStream( configDataPtr, &metaDataStream );
+               }
+
+            // otherwise, assume meta data access failure
+            else
+               {
+                // show error message, end program
+                   // function: printf
+                printf( "\nMetadata Upload Error: %s, program aborted\n", 
+                                                                 errorMessage );
+               }
+           }
+
         // clean up config data as needed
            // function: clearConfigData
         configDataPtr = clearConfigData( configDataPtr );
@@ -129,6 +203,10 @@ void clearCmdLineStruct( CmdLineData *clDataPtr )
      clDataPtr->configDisplayFlag = false;
      clDataPtr->mdDisplayFlag = false;
      clDataPtr->runSimFlag = false;
+     clDataPtr->runStreamFlag = false;
+     clDataPtr->virtualTimeFlag = false;
+     clDataPtr->timeScaleFlag = false;
+     clDataPtr->timeScale = 1.0;
      clDataPtr->fileName[ 0 ] = NULL_CHAR; 
 
      // void function, no return 
@@ -172,6 +250,7 @@ bool processCmdLine( int numArgs, char **strVector, CmdLineData *clDataPtr )
 
        // declare other variables
        int fileStrLen, fileStrSubLoc; 
+       char *endPtr = NULL;
 
     // must have prog name, at least one switch, and config file name, minimum
     if( numArgs >= MIN_NUM_ARGS )
@@ -207,6 +286,49 @@ bool processCmdLine( int numArgs, char **strVector, CmdLineData *clDataPtr )
                     // set at least one switch flag
                     atLeastOneSwitchFlag = true;
                    }
+                // otherwise, check for -rp (run simulator pipelined)
+                else if( compareString( strVector[ argIndex ], "-rp" ) == STR_EQ )
+                   {
+                    // set run stream flag
+                    clDataPtr->runStreamFlag = true; 
+
+                    // set at least one switch flag
+                    atLeastOneSwitchFlag = true;
+                   }
+                // otherwise, check for -vt (virtual time), modifies a run
+                else if( compareString( strVector[ argIndex ], "-vt" ) == STR_EQ )
+                   {
+                    // set virtual time flag
+                    clDataPtr->virtualTimeFlag = true; 
+                   }
+                // otherwise, check for -ts (time scale), modifies a run,
+                // factor must follow and precede the config file name
+                else if( compareString( strVector[ argIndex ], "-ts" ) == STR_EQ )
+                   {
+                    // move to factor, check for factor present and in range
+                       // function: strtod, valueInRange
+                    argIndex++;
+
+                    if( argIndex < numArgs - 1 )
+                       {
+                        clDataPtr->timeScale 
+                                   = strtod( strVector[ argIndex ], &endPtr );
+                       }
+
+                    if( argIndex >= numArgs - 1 || *endPtr != NULL_CHAR
+                         || !valueInRange( CFG_TIME_SCALE_CODE, 0, 
+                                                  clDataPtr->timeScale, "" ) )
+                       {
+                        // reset struct, bad time scale fails command line
+                           // function: clearStruct
+                        clearCmdLineStruct( clDataPtr );
+
+                        return false;
+                       }
+
+                    // set time scale flag
+                    clDataPtr->timeScaleFlag = true; 
+                   }
                 // otherwise, check for file name, ending in .cfg
                 // must be last four
                 else 
@@ -262,9 +384,13 @@ void showCommandLineFormat()
     // display command line format 
        // function: printf
     printf( "Command Line Format:\n" );
-    printf( "     sim_01 [-dc] [-dm] [-rs] <config file name>\n" );
+    printf( "     sim_01 [-dc] [-dm] [-rs] [-rp] [-vt] [-ts factor] "
+                                                        "<config file name>\n" );
     printf( "     -dc [optional] displays configuration data\n" );
     printf( "     -dm [optional] displays meta data\n" );
     printf( "     -rs [optional] runs simulator\n" );
+    printf( "     -rp [optional] runs simulator while meta data loads\n" );
+    printf( "     -vt [optional] runs simulator in virtual time\n" );
+    printf( "     -ts [optional] runs real time waits factor times faster\n" );
     printf( "     required config file name\n" );
    }
\ No newline at end of file
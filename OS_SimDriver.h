@@ -8,6 +8,7 @@
 #include "StringUtils.h"
 #include "configops.h"
 #include "metadataops.h"
+#include "mdbops.h"
 #include "simulator.h"
 
 
@@ -21,6 +22,10 @@ typedef struct CmdLineDataStruct
     bool configDisplayFlag;
     bool mdDisplayFlag;
     bool runSimFlag;
+    bool runStreamFlag;
+    bool virtualTimeFlag;
+    bool timeScaleFlag;
+    double timeScale;
                                                 
     char fileName[ STD_STR_LEN ];
    } CmdLineData;
@@ -0,0 +1,368 @@
+// POSIX monotonic clock and file status
+#define _POSIX_C_SOURCE 200809L
+
+// header files
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "simulator.h"
+
+// Constants
+typedef enum { BENCH_MIN_ARGS = 2,
+               DEFAULT_BENCH_RUNS = 15,
+               MAX_BENCH_RUNS = 10000,
+               BENCH_LOG_LINES = 2000,
+               BENCH_LOG_NONE = -1 } BENCH_CONSTANTS;
+
+// Function prototypes
+double getBenchTime();
+int compareSampleTime( const void *firstPtr, const void *secondPtr );
+void reportBench( const char *benchName, double *samples, int numRuns,
+                      double numItems, const char *itemName, double numBytes );
+void releasePCBList( PCBType *PCBHead );
+
+/*
+Name: main
+Process: benchmark driver; loads the config file and its metadata file,
+         then times each stage over repeated runs: config upload,
+         metadata upload (sequential and parallel), PCB construction,
+         memory simulation, log line building and dump, and runSim end to
+         end with timer waits off, logging to a null file and monitor
+         output silenced; each stage is reported as one JSON line with
+         median and p99 times
+Function Input/Parameters: number of arguments (int),
+                           vector of arguments (char **)
+Function Output/Parameters: none
+Function Output/Returned: zero on success, one on failure (int)
+Device Input/file: config and metadata files uploaded
+Device Output/monitor: one result line per benchmark
+Dependencies: getConfigData, getMetaData, getMetaDataParallel, stat,
+              getBenchTime, clearConfigData, clearMetaDataList, reportBench,
+              decodeMetaData, buildProcessIndex, startPCB, releasePCBList,
+              clearProcessIndex, addMem, memSim, freeMem, addEvent, fopen,
+              dumpFile, fclose, setTimerWait, fflush, dup, open, dup2,
+              nextOpCode, runSim, close, printf
+*/
+int main( int argc, char **argv )
+   {
+    // initialize function/variables
+    ConfigDataType *configDataPtr = NULL, *benchConfigPtr = NULL;
+    ConfigDataType runConfig;
+    OpCodeType *metaDataPtr = NULL, *benchDataPtr = NULL, *opPtr;
+    ProcessIndexTable procIndex;
+    PCBType *PCBHead;
+    memHolder *usedMem;
+    logToFile *fileHolder, *nextLine;
+    FILE *nullFile;
+    struct stat fileStatus;
+    char errorMessage[ MAX_STR_LEN ];
+    char fileLine[ STD_STR_LEN ];
+    double samples[ MAX_BENCH_RUNS ], startTime;
+    int numRuns = DEFAULT_BENCH_RUNS, runIndex, lineIndex;
+    int numOps = 0, numProcs = 0, numMemOps = 0;
+    int savedStdOut, nullOut;
+    const char *fileName;
+
+    // check for run count option and config file name
+       // function: compareString, printf
+    if( argc == BENCH_MIN_ARGS + 2 && compareString( argv[ 1 ], "-r" ) == STR_EQ )
+       {
+        numRuns = atoi( argv[ 2 ] );
+       }
+
+    else if( argc != BENCH_MIN_ARGS )
+       {
+        numRuns = 0;
+       }
+
+    if( numRuns < 1 || numRuns > MAX_BENCH_RUNS )
+       {
+        printf( "Command Line Format:\n" );
+        printf( "     bench [-r runs] <config file name>\n" );
+        return 1;
+       }
+
+    fileName = argv[ argc - 1 ];
+
+    // upload config and metadata once for later stages
+       // function: getConfigData, getMetaData, printf
+    if( !getConfigData( fileName, &configDataPtr, errorMessage ) )
+       {
+        printf( "Config Upload Error: %s\n", errorMessage );
+        return 1;
+       }
+
+    if( !getMetaData( configDataPtr->metaDataFileName, &metaDataPtr,
+                                     errorMessage ) || metaDataPtr == NULL )
+       {
+        printf( "Metadata Upload Error: %s\n", errorMessage );
+        clearConfigData( configDataPtr );
+        return 1;
+       }
+
+    // count ops, processes and memory ops
+    for( opPtr = metaDataPtr; opPtr != NULL; opPtr = nextOpCode( opPtr ) )
+       {
+        numOps++;
+        numProcs += opPtr->command == APP_CMD_CODE
+                                        && opPtr->strArg1 == START_ARG_CODE;
+        numMemOps += opPtr->command == MEM_CMD_CODE;
+       }
+
+    // get metadata file size
+       // function: stat
+    stat( configDataPtr->metaDataFileName, &fileStatus );
+
+    // time config upload
+       // function: getBenchTime, getConfigData, clearConfigData, reportBench
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        startTime = getBenchTime();
+        getConfigData( fileName, &benchConfigPtr, errorMessage );
+        samples[ runIndex ] = getBenchTime() - startTime;
+        benchConfigPtr = clearConfigData( benchConfigPtr );
+       }
+
+    reportBench( "config", samples, numRuns, 1, "files", 0 );
+
+    // time sequential metadata upload
+       // function: getBenchTime, getMetaData, clearMetaDataList, reportBench
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        startTime = getBenchTime();
+        getMetaData( configDataPtr->metaDataFileName, &benchDataPtr,
+                                                               errorMessage );
+        samples[ runIndex ] = getBenchTime() - startTime;
+        benchDataPtr = clearMetaDataList( benchDataPtr );
+       }
+
+    reportBench( "parse", samples, numRuns, numOps, "ops",
+                                                (double)fileStatus.st_size );
+
+    // time parallel metadata upload
+       // function: getBenchTime, getMetaDataParallel, clearMetaDataList,
+       //           reportBench
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        startTime = getBenchTime();
+        getMetaDataParallel( configDataPtr->metaDataFileName, &benchDataPtr,
+                                                            errorMessage, 0 );
+        samples[ runIndex ] = getBenchTime() - startTime;
+        benchDataPtr = clearMetaDataList( benchDataPtr );
+       }
+
+    reportBench( "parse_parallel", samples, numRuns, numOps, "ops",
+                                                (double)fileStatus.st_size );
+
+    // decode once for later stages
+       // function: decodeMetaData
+    decodeMetaData( metaDataPtr, configDataPtr );
+
+    // time process index and PCB list construction
+       // function: getBenchTime, buildProcessIndex, startPCB,
+       //           releasePCBList, clearProcessIndex, reportBench
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        startTime = getBenchTime();
+        buildProcessIndex( metaDataPtr, &procIndex );
+        PCBHead = startPCB( &procIndex, configDataPtr );
+        samples[ runIndex ] = getBenchTime() - startTime;
+        releasePCBList( PCBHead );
+        clearProcessIndex( &procIndex );
+       }
+
+    reportBench( "pcb_build", samples, numRuns, numProcs, "processes", 0 );
+
+    // time memory allocate and access ops, without display
+       // function: getBenchTime, addMem, memSim, freeMem, reportBench
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        usedMem = addMem( NULL, 0, configDataPtr->memAvailable - 1 );
+        startTime = getBenchTime();
+
+        for( opPtr = metaDataPtr; opPtr != NULL; opPtr = nextOpCode( opPtr ) )
+           {
+            if( opPtr->command == MEM_CMD_CODE )
+               {
+                memSim( opPtr, BENCH_LOG_NONE, 0, NULL, RUN,
+                                                     configDataPtr, usedMem );
+               }
+           }
+
+        samples[ runIndex ] = getBenchTime() - startTime;
+        freeMem( usedMem );
+       }
+
+    reportBench( "mem_sim", samples, numRuns, numMemOps, "ops", 0 );
+
+    // time log line building and dump to null file
+       // function: fopen, snprintf, getBenchTime, addEvent, dumpFile, free,
+       //           reportBench
+    nullFile = fopen( "/dev/null", "w" );
+
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        fileHolder = NULL;
+        startTime = getBenchTime();
+
+        for( lineIndex = 0; lineIndex < BENCH_LOG_LINES; lineIndex++ )
+           {
+            snprintf( fileLine, STD_STR_LEN,
+                         "OS: Process: %d set to READY state\n", lineIndex );
+            fileHolder = addEvent( fileHolder, lineIndex * 1000LL, fileLine );
+           }
+
+        dumpFile( fileHolder, nullFile );
+        samples[ runIndex ] = getBenchTime() - startTime;
+
+        while( fileHolder != NULL )
+           {
+            nextLine = fileHolder->next;
+            free( fileHolder );
+            fileHolder = nextLine;
+           }
+       }
+
+    fclose( nullFile );
+    reportBench( "log_lines", samples, numRuns, BENCH_LOG_LINES, "lines", 0 );
+
+    // time end to end simulation, timer waits off, log to null file only,
+    // monitor output silenced so result lines stay machine readable
+       // function: setTimerWait, copyString, fflush, dup, open, dup2,
+       //           getBenchTime, runSim, close, reportBench
+    runConfig = *configDataPtr;
+    runConfig.logToCode = LOGTO_FILE_CODE;
+    copyString( runConfig.logToFileName, "/dev/null" );
+    setTimerWait( false );
+
+    fflush( stdout );
+    savedStdOut = dup( STDOUT_FILENO );
+    nullOut = open( "/dev/null", O_WRONLY );
+    dup2( nullOut, STDOUT_FILENO );
+
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        startTime = getBenchTime();
+        runSim( &runConfig, metaDataPtr );
+        samples[ runIndex ] = getBenchTime() - startTime;
+       }
+
+    fflush( stdout );
+    dup2( savedStdOut, STDOUT_FILENO );
+    close( savedStdOut );
+    close( nullOut );
+    setTimerWait( true );
+    reportBench( "run_sim", samples, numRuns, numOps, "ops", 0 );
+
+    // release data, return success
+       // function: clearMetaDataList, clearConfigData
+    clearMetaDataList( metaDataPtr );
+    clearConfigData( configDataPtr );
+    return 0;
+   }
+
+/*
+Name: compareSampleTime
+Process: qsort comparison of two sample times, ascending
+Function Input/Parameters: pointers to sample times (const void *)
+Function Output/Parameters: none
+Function Output/Returned: negative, zero, or positive order (int)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+int compareSampleTime( const void *firstPtr, const void *secondPtr )
+   {
+    double firstTime = *(const double *)firstPtr;
+    double secondTime = *(const double *)secondPtr;
+
+    return ( firstTime > secondTime ) - ( firstTime < secondTime );
+   }
+
+/*
+Name: getBenchTime
+Process: reads the monotonic clock in seconds
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: clock time in seconds (double)
+Device Input/device: none
+Device Output/device: none
+Dependencies: clock_gettime
+*/
+double getBenchTime()
+   {
+    struct timespec clockTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &clockTime );
+
+    return (double)clockTime.tv_sec + (double)clockTime.tv_nsec / 1.0e9;
+   }
+
+/*
+Name: releasePCBList
+Process: frees each PCB in a PCB list
+Function Input/Parameters: pointer to PCB head (PCBType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: free
+*/
+void releasePCBList( PCBType *PCBHead )
+   {
+    PCBType *nextPCB;
+
+    while( PCBHead != NULL )
+       {
+        nextPCB = PCBHead->nextPCB;
+        free( PCBHead );
+        PCBHead = nextPCB;
+       }
+   }
+
+/*
+Name: reportBench
+Process: sorts the run samples and displays one JSON line with the
+         median and p99 times, item rate from the median, and file
+         rate when a byte count is given
+Function Input/Parameters: benchmark name (const char *),
+                           run sample times in seconds (double *),
+                           number of runs (int),
+                           items handled per run (double),
+                           item name for the rate key (const char *),
+                           bytes handled per run, zero for none (double)
+Function Output/Parameters: sorted sample times (double *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/monitor: result line displayed
+Dependencies: qsort, printf
+*/
+void reportBench( const char *benchName, double *samples, int numRuns,
+                       double numItems, const char *itemName, double numBytes )
+   {
+    // initialize function/variables
+    double medianTime, p99Time;
+    int p99Index = ( numRuns * 99 + 99 ) / 100 - 1;
+
+    // sort samples, pick median and p99
+       // function: qsort
+    qsort( samples, numRuns, sizeof( double ), compareSampleTime );
+    medianTime = samples[ numRuns / 2 ];
+    p99Time = samples[ p99Index ];
+
+    // display result line
+       // function: printf
+    printf( "{\"bench\": \"%s\", \"runs\": %d, \"median_s\": %.9f, "
+            "\"p99_s\": %.9f, \"%s\": %.0f, \"%s_per_s\": %.1f",
+            benchName, numRuns, medianTime, p99Time, itemName, numItems,
+            itemName, medianTime > 0.0 ? numItems / medianTime : 0.0 );
+
+    if( numBytes > 0.0 )
+       {
+        printf( ", \"mb_per_s\": %.3f",
+                   medianTime > 0.0 ? numBytes / medianTime / 1.0e6 : 0.0 );
+       }
+
+    printf( "}\n" );
+   }
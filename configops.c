@@ -43,10 +43,10 @@ Dependencies: copyString
 */
 void configCodeToString( int code, char *outString )
    {
-    // Define array with eight items, and short (10) lengths
-    char displayStrings[ 8 ][ 10 ] = { "SJF-N", "SRTF-P", "FCFS-P", 
-                                       "RR-P", "FCFS-N", "Monitor",
-                                       "File", "Both" };
+    // Define array with ten items, and short (10) lengths
+    char displayStrings[ 10 ][ 10 ] = { "SJF-N", "SRTF-P", "FCFS-P", 
+                                        "RR-P", "FCFS-N", "MLFQ", "CFS",
+                                        "Monitor", "File", "Both" };
     // copy string to return parameter
        // function: copyString
     copyString( outString, displayStrings[ code ] );
@@ -66,6 +66,7 @@ void displayConfigData( ConfigDataType *configData )
    {
     // intialize function/variables
     char displayString[ STD_STR_LEN ];
+    int level;
     
     // print lines of display for all member values
        // function: printf, codeToString (translates coded items)
@@ -90,7 +91,48 @@ void displayConfigData( ConfigDataType *configData )
     printf( "I/O cycle rate         : %d\n", configData->ioCycleRate );
     configCodeToString( configData->logToCode, displayString );
     printf( "Log to selection       : %s\n", displayString );
-    printf( "Log file name          : %s\n\n", configData->logToFileName );
+    printf( "Log file name          : %s\n", configData->logToFileName );
+    printf( "Time mode              : " );
+    if( configData->timeModeCode == TIME_VIRTUAL_CODE )
+       {
+        printf( "Virtual\n" );
+       }
+    else
+       {
+        printf( "Real\n" );
+       }
+    printf( "Time scale             : %.2f\n", configData->timeScale );
+    printf( "Worker threads         : " );
+    if( configData->workerThreads == 0 )
+       {
+        printf( "Cores\n" );
+       }
+    else
+       {
+        printf( "%d\n", configData->workerThreads );
+       }
+    printf( "CPU count              : %d\n", configData->cpuCount );
+    printf( "Process execution      : " );
+    if( configData->execModeCode == EXEC_POOL_CODE )
+       {
+        printf( "Pool\n" );
+       }
+    else
+       {
+        printf( "Coroutine\n" );
+       }
+    if( configData->cpuSchedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        printf( "MLFQ levels            : %d\n", configData->mlfqLevels );
+        printf( "MLFQ quanta            :" );
+        for( level = 0; level < configData->mlfqLevels; level++ )
+           {
+            printf( " %d", configData->mlfqQuanta[ level ] );
+           }
+        printf( "\n" );
+        printf( "MLFQ boost time        : %d\n", configData->mlfqBoostTime );
+       }
+    printf( "\n" );
    }
 
  /*
@@ -104,8 +146,8 @@ void displayConfigData( ConfigDataType *configData )
  Device Output/monitor: displayed as specified
  Dependencies: copyString, fopen, getStringToDelimiter, compareString,
                fclose, malloc, free, stripTrailingSpaces, getDataLineCode,
-               fscanf, setStrToLowerCase, valueInRange, getCpuSchedCode,
-               getLogToCode
+               fscanf, getStringToLineEnd, setStrToLowerCase, valueInRange, getCpuSchedCode,
+               getLogToCode, getQuantaList, setMlfqQuanta
  */
  bool getConfigData( const char *fileName, 
                                 ConfigDataType **configData, char *endStateMsg )
@@ -125,6 +167,8 @@ void displayConfigData( ConfigDataType *configData )
         FILE *fileAccessPtr;
         char dataBuffer[ MAX_STR_LEN ], lowerCaseDataBuffer[ MAX_STR_LEN ];
         int intData, dataLineCode, lineCtr = 0;
+        unsigned int requiredLines = 0, lineBit;
+        bool endFlag = false;
         double doubleData; 
 
      // set endStateMsg to success
@@ -173,8 +217,18 @@ void displayConfigData( ConfigDataType *configData )
          // function: malloc
       tempData = (ConfigDataType *) malloc( sizeof( ConfigDataType ) ); 
 
-      // loop to end of config data items
-      while( lineCtr < NUM_DATA_LINES )
+      // set defaults for optional config items
+      tempData->timeModeCode = TIME_REAL_CODE;
+      tempData->timeScale = 1.0;
+      tempData->workerThreads = 0;
+      tempData->cpuCount = 1;
+      tempData->execModeCode = EXEC_COROUTINE_CODE;
+      tempData->mlfqLevels = 3;
+      tempData->mlfqQuantaCount = 0;
+      tempData->mlfqBoostTime = 1000;
+
+      // loop to end of config line, optional items may be anywhere
+      while( !endFlag )
          {
           // get line leader, check for failure
              // function: getStringToDelimiter
@@ -203,6 +257,18 @@ void displayConfigData( ConfigDataType *configData )
              // function: stripTrailingSpaces
           stripTrailingSpaces( dataBuffer );
 
+          // check for end of sim config string, has no colon
+             // function: compareString
+          if( compareString( dataBuffer, 
+                               "End Simulator Configuration File." ) == STR_EQ
+              || compareString( dataBuffer, 
+                                "End Simulator Configuration File" ) == STR_EQ )
+             {
+              endFlag = true;
+
+              continue;
+             }
+
           // find correct data line code number from string
              // function: getDataLineCode
           dataLineCode = getDataLineCode( dataBuffer );
@@ -212,8 +278,9 @@ void displayConfigData( ConfigDataType *configData )
              { 
               // get data value
 
-                 // check for version number (double value)
-                 if( dataLineCode == CFG_VERSION_CODE )
+                 // check for version number or time scale (double value)
+                 if( dataLineCode == CFG_VERSION_CODE 
+                                      || dataLineCode == CFG_TIME_SCALE_CODE )
                     {
                      // get version number
                         // function: fscanf
@@ -226,7 +293,9 @@ void displayConfigData( ConfigDataType *configData )
                           || dataLineCode == CFG_LOG_FILE_NAME_CODE 
                              || dataLineCode == CFG_CPU_SCHED_CODE 
                                 || dataLineCode == CFG_LOG_TO_CODE 
-                                   || dataLineCode == CFG_MEM_DISPLAY_CODE )
+                                   || dataLineCode == CFG_MEM_DISPLAY_CODE
+                                      || dataLineCode == CFG_TIME_MODE_CODE
+                                         || dataLineCode == CFG_EXEC_MODE_CODE )
                     {
                      // get string input 
                         // function: fscanf
@@ -237,6 +306,19 @@ void displayConfigData( ConfigDataType *configData )
                      setStrToLowerCase( lowerCaseDataBuffer, dataBuffer );
                     }
 
+                 // otherwise, check for MLFQ quanta list (rest of line, 
+                 //   may hold spaces)
+                 else if( dataLineCode == CFG_MLFQ_QUANTA_CODE )
+                    {
+                     // get line input
+                        // function: getStringToLineEnd
+                     getStringToLineEnd( fileAccessPtr, dataBuffer );
+
+                     // set string to lower case for testing in valueInRange
+                        // function: setStrToLowerCase
+                     setStrToLowerCase( lowerCaseDataBuffer, dataBuffer );
+                    }
+
                  // otherwise, assume integer data
                  else 
                     {
@@ -308,6 +390,51 @@ void displayConfigData( ConfigDataType *configData )
 
                          copyString( tempData->logToFileName, dataBuffer );
                          break;
+
+                      case CFG_TIME_MODE_CODE:
+
+                         tempData->timeModeCode 
+                             = compareString( lowerCaseDataBuffer, "virtual" ) 
+                                 == STR_EQ ? TIME_VIRTUAL_CODE : TIME_REAL_CODE;
+                         break;
+
+                      case CFG_TIME_SCALE_CODE:
+
+                         tempData->timeScale = doubleData;
+                         break;
+
+                      case CFG_WORKER_THREADS_CODE:
+
+                         tempData->workerThreads = intData;
+                         break;
+
+                      case CFG_CPU_COUNT_CODE:
+
+                         tempData->cpuCount = intData;
+                         break;
+
+                      case CFG_EXEC_MODE_CODE:
+
+                         tempData->execModeCode 
+                             = compareString( lowerCaseDataBuffer, "pool" ) 
+                                 == STR_EQ ? EXEC_POOL_CODE : EXEC_COROUTINE_CODE;
+                         break;
+
+                      case CFG_MLFQ_LEVELS_CODE:
+
+                         tempData->mlfqLevels = intData;
+                         break;
+
+                      case CFG_MLFQ_QUANTA_CODE:
+
+                         getQuantaList( lowerCaseDataBuffer, 
+                              tempData->mlfqQuanta, &tempData->mlfqQuantaCount );
+                         break;
+
+                      case CFG_MLFQ_BOOST_CODE:
+
+                         tempData->mlfqBoostTime = intData;
+                         break;
                      }
                  }
 
@@ -349,17 +476,23 @@ void displayConfigData( ConfigDataType *configData )
               // return corrupt config file code
               return false; 
              }
-           // increment line counter
-           lineCtr++;
+           // count each required line once, optional items are not counted
+           if( dataLineCode >= CFG_VERSION_CODE 
+                                   && dataLineCode <= CFG_LOG_FILE_NAME_CODE )
+              {
+               lineBit = 1u << ( dataLineCode - CFG_VERSION_CODE );
+
+               if( ( requiredLines & lineBit ) == 0 )
+                  {
+                   requiredLines |= lineBit;
+                   lineCtr++;
+                  }
+              }
          }
       // end master loop
 
-      // acquire end of sim config string 
-         // function: getStringToDelimiter, compareString
-      if( !getStringToDelimiter( fileAccessPtr, PERIOD, dataBuffer )
-          || compareString( dataBuffer,
-                                     "End Simulator Configuration File" )
-                                                                       != STR_EQ )
+      // check for a required line missing
+      if( lineCtr < NUM_DATA_LINES )
           {
            // free temp struct memory 
               // function: free
@@ -369,13 +502,19 @@ void displayConfigData( ConfigDataType *configData )
               // function: fclose
            fclose( fileAccessPtr );
 
-           // set end state message to corrupt configuraiton end line
+           // set end state message to missing configuration line
               // function: copyString
-           copyString( endStateMsg, "Configuration end line capture error" );
+           copyString( endStateMsg, 
+                                 "Configuration required line missing error" );
 
-           // return corrupt file data
+           // return incomplete file error
            return false;
           }
+
+        // fill MLFQ quanta for levels not given
+           // function: setMlfqQuanta
+        setMlfqQuanta( tempData );
+
         // test for "file only" output so memory diagnostics do not display
         tempData->memDisplay = tempData->memDisplay 
                                           && tempData->logToCode != LOGTO_FILE_CODE;
@@ -440,6 +579,22 @@ ConfigDataCodes getCpuSchedCode( const char *lowerCaseCodeStr )
         returnVal = CPU_SCHED_RR_P_CODE;
        }
 
+    // check for MLFQ 
+       // function: compareString
+    if( compareString( lowerCaseCodeStr, "mlfq" ) == STR_EQ )
+       {
+        // set MLFQ code 
+        returnVal = CPU_SCHED_MLFQ_CODE;
+       }
+
+    // check for CFS 
+       // function: compareString
+    if( compareString( lowerCaseCodeStr, "cfs" ) == STR_EQ )
+       {
+        // set CFS code 
+        returnVal = CPU_SCHED_CFS_CODE;
+       }
+
     // return the selected value
     return returnVal; 
    }
@@ -510,6 +665,47 @@ ConfigCodeMessages getDataLineCode( const char *dataBuffer )
         return CFG_LOG_FILE_NAME_CODE;
        }     
 
+    if( compareString( dataBuffer, "Time Mode (Real/Virtual)" ) == STR_EQ )
+       {
+        return CFG_TIME_MODE_CODE;
+       }
+
+    if( compareString( dataBuffer, "Time Scale (x real time)" ) == STR_EQ )
+       {
+        return CFG_TIME_SCALE_CODE;
+       }
+
+    if( compareString( dataBuffer, "Worker Threads (0 for cores)" ) == STR_EQ )
+       {
+        return CFG_WORKER_THREADS_CODE;
+       }
+
+    if( compareString( dataBuffer, "CPU Count" ) == STR_EQ )
+       {
+        return CFG_CPU_COUNT_CODE;
+       }
+
+    if( compareString( dataBuffer, "Process Execution (Coroutine/Pool)" ) 
+                                                                    == STR_EQ )
+       {
+        return CFG_EXEC_MODE_CODE;
+       }
+
+    if( compareString( dataBuffer, "MLFQ Levels" ) == STR_EQ )
+       {
+        return CFG_MLFQ_LEVELS_CODE;
+       }
+
+    if( compareString( dataBuffer, "MLFQ Quanta (cycles)" ) == STR_EQ )
+       {
+        return CFG_MLFQ_QUANTA_CODE;
+       }
+
+    if( compareString( dataBuffer, "MLFQ Boost Time (msec)" ) == STR_EQ )
+       {
+        return CFG_MLFQ_BOOST_CODE;
+       }
+
     // return corrupt leader line error code
     return CFG_CORRUPT_PROMPT_ERR;
    }
@@ -551,6 +747,132 @@ ConfigDataCodes getLogToCode( const char *lowerCaseLogToStr )
     return returnVal;
    }
 
+/*
+Name: getQuantaList
+Process: converts a comma separated list of MLFQ quanta, highest level
+         first, to cycle counts, each from 0 to the quantum limit, at 
+         most one per level; spaces around values are skipped
+Function Input/Parameters: quanta list string (const char *)
+Function Ouput/Parameters: quanta by level (int *), 
+                           number of quanta (int *)
+Function Output/Returned: Boolean result, false if the list is malformed
+                          or out of range (bool)
+Device Input/device: none 
+Device Output/device: none 
+Dependencies: none
+*/
+bool getQuantaList( const char *listStr, int *quanta, int *quantaCount )
+   {
+    // initialize function/variables
+    int index = 0, value = 0, digitCount = 0;
+    bool spaceFlag = false;
+
+    *quantaCount = 0;
+
+    // loop across list characters, through the end of string
+    while( true )
+       {
+        // check for digit, add to value
+        if( listStr[ index ] >= '0' && listStr[ index ] <= '9' )
+           {
+            // check for space inside a value
+            if( spaceFlag )
+               {
+                return false;
+               }
+
+            value = value * 10 + ( listStr[ index ] - '0' );
+            digitCount++;
+
+            // check for value over limit
+            if( value > MLFQ_MAX_QUANTUM )
+               {
+                return false;
+               }
+           }
+
+        // otherwise, check for space, skip it
+        else if( listStr[ index ] == SPACE || listStr[ index ] == '\t' )
+           {
+            spaceFlag = digitCount > 0;
+           }
+
+        // otherwise, check for end of one value
+        else if( listStr[ index ] == COMMA || listStr[ index ] == NULL_CHAR )
+           {
+            // check for empty value or too many values
+            if( digitCount == 0 || *quantaCount == MLFQ_MAX_LEVELS )
+               {
+                return false;
+               }
+
+            quanta[ *quantaCount ] = value;
+            ( *quantaCount )++;
+
+            // check for end of list
+            if( listStr[ index ] == NULL_CHAR )
+               {
+                return true;
+               }
+
+            value = 0;
+            digitCount = 0;
+            spaceFlag = false;
+           }
+
+        // otherwise, assume bad character
+        else
+           {
+            return false;
+           }
+
+        index++;
+       }
+   }
+
+/*
+Name: setMlfqQuanta
+Process: fills the MLFQ quanta of levels past the given list, by 
+         repeating the last given quantum, or if none were given, by 
+         doubling the quantum time at each level down
+Function Input/Parameters: pointer to config data structure (ConfigDataType *)
+Function Ouput/Parameters: updated MLFQ quanta (ConfigDataType *)
+Function Output/Returned: none
+Device Input/device: none 
+Device Output/device: none 
+Dependencies: none
+*/
+void setMlfqQuanta( ConfigDataType *configData )
+   {
+    // initialize function/variables
+    bool doubleFlag = configData->mlfqQuantaCount == 0;
+    int level;
+
+    // check for no list, start from quantum time
+    if( doubleFlag )
+       {
+        configData->mlfqQuanta[ 0 ] = configData->quantumCycles;
+        configData->mlfqQuantaCount = 1;
+       }
+
+    // fill lower levels, doubled up to the quantum limit or repeated
+    for( level = configData->mlfqQuantaCount; level < MLFQ_MAX_LEVELS; 
+                                                                      level++ )
+       {
+        configData->mlfqQuanta[ level ] = configData->mlfqQuanta[ level - 1 ];
+
+        if( doubleFlag )
+           {
+            configData->mlfqQuanta[ level ] *= 2;
+
+            if( configData->mlfqQuanta[ level ] > MLFQ_MAX_QUANTUM )
+               {
+                configData->mlfqQuanta[ level ] = MLFQ_MAX_QUANTUM;
+               }
+           }
+       }
+   }
+
 /*
 Name: stripTrailingSpaces
 Process: removes trailing spaces from input config leader lines
@@ -590,7 +912,7 @@ Function Ouput/Parameters: none
 Function Output/Returned: Boolean result of range test (bool)
 Device Input/device: none 
 Device Output/device: none 
-Dependencies: compareString
+Dependencies: compareString, getQuantaList
 */
 bool valueInRange( int lineCode, int intVal, 
                               double doubleVal, const char *lowerCaseStringVal )
@@ -600,6 +922,9 @@ bool valueInRange( int lineCode, int intVal,
         // set result to true, all tests are to find false
         bool result = true; 
 
+        // scratch quanta for list checks
+        int quanta[ MLFQ_MAX_LEVELS ], quantaCount;
+
     // use line code to identify prompt line
     switch( lineCode )
        { 
@@ -624,7 +949,9 @@ bool valueInRange( int lineCode, int intVal,
                && compareString( lowerCaseStringVal, "sjf-n" ) != STR_EQ 
                && compareString( lowerCaseStringVal, "srtf-p" ) != STR_EQ
                && compareString( lowerCaseStringVal, "fcfs-p" ) != STR_EQ
-               && compareString( lowerCaseStringVal, "rr-p" ) != STR_EQ )
+               && compareString( lowerCaseStringVal, "rr-p" ) != STR_EQ
+               && compareString( lowerCaseStringVal, "mlfq" ) != STR_EQ
+               && compareString( lowerCaseStringVal, "cfs" ) != STR_EQ )
               {
                // set Boolean result to false
                result = false;
@@ -715,6 +1042,115 @@ bool valueInRange( int lineCode, int intVal,
            
            // break
            break;
+
+       // check for time mode
+       case CFG_TIME_MODE_CODE:
+
+           // check for not finding either "real" or "virtual"
+              // function: compareString
+           if( compareString( lowerCaseStringVal, "real" ) != STR_EQ 
+               && compareString( lowerCaseStringVal, "virtual" ) != STR_EQ )
+              { 
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for time scale
+       case CFG_TIME_SCALE_CODE:
+
+           // check for time scale limits exceeded
+           if( doubleVal < 0.01 || doubleVal > 1000.00 )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for worker threads, zero selects online cores
+       case CFG_WORKER_THREADS_CODE:
+
+           // check for worker thread limits exceeded
+           if( intVal < 0 || intVal > 1024 )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for simulated cpu count
+       case CFG_CPU_COUNT_CODE:
+
+           // check for cpu count limits exceeded
+           if( intVal < 1 || intVal > 64 )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for process execution mode
+       case CFG_EXEC_MODE_CODE:
+
+           // check for not finding either "coroutine" or "pool"
+              // function: compareString
+           if( compareString( lowerCaseStringVal, "coroutine" ) != STR_EQ 
+               && compareString( lowerCaseStringVal, "pool" ) != STR_EQ )
+              { 
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for MLFQ level count
+       case CFG_MLFQ_LEVELS_CODE:
+
+           // check for level limits exceeded
+           if( intVal < 1 || intVal > MLFQ_MAX_LEVELS )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for MLFQ quanta list
+       case CFG_MLFQ_QUANTA_CODE:
+
+           // check for list not read
+              // function: getQuantaList
+           if( !getQuantaList( lowerCaseStringVal, quanta, &quantaCount ) )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
+
+       // check for MLFQ boost period, zero for no boost
+       case CFG_MLFQ_BOOST_CODE:
+
+           // check for boost time limits exceeded
+           if( intVal < 0 || intVal > 1000000 )
+              {  
+               // set Boolean result to false
+               result = false;
+              } 
+           
+           // break
+           break;
        }
     
     // return result of limits analysis
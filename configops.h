@@ -8,6 +8,11 @@
 #include <stdlib.h>
 
 // Global Constants - may be used in other files
+
+// multilevel feedback queue limits
+typedef enum { MLFQ_MAX_LEVELS = 16,
+               MLFQ_MAX_QUANTUM = 1000 } MlfqConstants;
+
 typedef struct ConfigDataType
    {
     double version;
@@ -20,6 +25,15 @@ typedef struct ConfigDataType
     int ioCycleRate;
     int logToCode;
     char logToFileName[ LARGE_STR_LEN ];
+    int timeModeCode;
+    double timeScale;
+    int workerThreads;
+    int cpuCount;
+    int execModeCode;
+    int mlfqLevels;
+    int mlfqQuanta[ MLFQ_MAX_LEVELS ];
+    int mlfqQuantaCount;
+    int mlfqBoostTime;
    } ConfigDataType;
 
 typedef enum { CFG_FILE_ACCESS_ERR,
@@ -35,18 +49,32 @@ typedef enum { CFG_FILE_ACCESS_ERR,
                CFG_PROC_CYCLES_CODE,
                CFG_IO_CYCLES_CODE,
                CFG_LOG_TO_CODE,
-               CFG_LOG_FILE_NAME_CODE } ConfigCodeMessages;
+               CFG_LOG_FILE_NAME_CODE,
+               CFG_TIME_MODE_CODE,
+               CFG_TIME_SCALE_CODE,
+               CFG_WORKER_THREADS_CODE,
+               CFG_CPU_COUNT_CODE,
+               CFG_EXEC_MODE_CODE,
+               CFG_MLFQ_LEVELS_CODE,
+               CFG_MLFQ_QUANTA_CODE,
+               CFG_MLFQ_BOOST_CODE } ConfigCodeMessages;
 
 typedef enum { CPU_SCHED_SJF_N_CODE,
                CPU_SCHED_SRTF_P_CODE,
                CPU_SCHED_FCFS_P_CODE,
                CPU_SCHED_RR_P_CODE,
                CPU_SCHED_FCFS_N_CODE,
+               CPU_SCHED_MLFQ_CODE,
+               CPU_SCHED_CFS_CODE,
                LOGTO_MONITOR_CODE,
                LOGTO_FILE_CODE,
                LOGTO_BOTH_CODE,
                NON_PREEMPTIVE_CODE,
-               PREEMPTIVE_CODE } ConfigDataCodes;
+               PREEMPTIVE_CODE,
+               TIME_REAL_CODE,
+               TIME_VIRTUAL_CODE,
+               EXEC_COROUTINE_CODE,
+               EXEC_POOL_CODE } ConfigDataCodes;
 
 // Function prototypes
 
@@ -115,6 +143,28 @@ ConfigCodeMessages getDataLineCode(const char *dataBuffer);
  */
 ConfigDataCodes getLogToCode(const char *lowerCaseLogToStr);
 
+/*
+ Name: getQuantaList
+ Process: converts a comma separated list of MLFQ quanta, highest level
+          first, to cycle counts, at most one per level
+ Function Input/Parameters: quanta list string (const char *)
+ Function Output/Parameters: quanta by level (int *), 
+                             number of quanta (int *)
+ Function Output/Returned: Boolean result, false if the list is malformed
+                           or out of range (bool)
+ */
+bool getQuantaList(const char *listStr, int *quanta, int *quantaCount);
+
+/*
+ Name: setMlfqQuanta
+ Process: fills the MLFQ quanta of levels past the given list, repeating
+          the last one, or doubling the quantum time if none were given
+ Function Input/Parameters: pointer to config data structure (ConfigDataType *)
+ Function Output/Parameters: updated MLFQ quanta (ConfigDataType *)
+ Function Output/Returned: none
+ */
+void setMlfqQuanta(ConfigDataType *configData);
+
 /*
  Name: stripTrailingSpaces
  Process: removes trailing spaces from input config leader lines
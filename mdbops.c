@@ -0,0 +1,318 @@
+// header files
+#include "mdbops.h"
+#include "StringUtils.h"
+#include "StandardConstants.h"
+
+/*
+Name: getMetaDataBinary
+Process: maps a compiled metadata file, checks the header and file size,
+         and builds the op code table by copying fixed-width records;
+         no text is parsed, but each record is checked in the same pass
+         for codes in range and for sys start first, app start and app end
+         alternating, and sys end last, so a damaged or hand-edited file
+         is rejected like the equivalent text
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: pointer
+                            to op code list head pointer (OpCodeType **),
+                            result message of function state
+                            after completion (char *)
+Function Output/Returned: Boolean result of operation (bool)
+Device Input/file: compiled op code list mapped
+Device Output/device: none
+Dependencies: copyString, openMetaDataBuffer, closeMetaDataBuffer, malloc,
+              linkOpCodeTable
+*/
+bool getMetaDataBinary( const char *fileName, 
+                                OpCodeType **opCodeDataHead, char *endStateMsg )
+   {
+    // initialize function/variables
+    MetaDataBuffer mdBuffer;
+    const MdbHeaderType *headerPtr;
+    const MdbOpRecord *recordPtr;
+    OpCodeTable opTable = { NULL, 0, 0 };
+    size_t expectedLength;
+    int index, processCount = 0;
+    bool validFlag = true, nestFlag = true, inProcessFlag = false;
+    bool sysStartFlag, sysEndFlag;
+
+    // initialize op code data pointer in case of return error
+    *opCodeDataHead = NULL; 
+
+    // intialize end state message 
+       // function: copyString
+    copyString( endStateMsg, "Metadata file upload successful" ); 
+
+    // map file
+       // function: openMetaDataBuffer
+    if( !openMetaDataBuffer( fileName, &mdBuffer ) )
+       { 
+        // set end state message, return file access error 
+           // function: copyString
+        copyString( endStateMsg, "Metadata file access error" );
+        return false;
+       }
+
+    // check for complete header
+    if( mdBuffer.length < sizeof( MdbHeaderType ) )
+       {
+        // release file, set end state message, return error
+           // function: closeMetaDataBuffer, copyString
+        closeMetaDataBuffer( &mdBuffer );
+        copyString( endStateMsg, "Compiled metadata corrupted header error" );
+        return false;
+       }
+
+    // set header at start of mapping, check file identification
+    headerPtr = (const MdbHeaderType *)mdBuffer.data;
+
+    for( index = 0; index < MDB_MAGIC_LEN; index++ )
+       {
+        validFlag = validFlag && headerPtr->magic[ index ] == MDB_MAGIC[ index ];
+       }
+
+    // check version and counts against actual file size
+    expectedLength = sizeof( MdbHeaderType ) 
+                   + (size_t)headerPtr->opCount * sizeof( MdbOpRecord );
+
+    if( !validFlag || headerPtr->version != MDB_VERSION 
+                   || headerPtr->opCount <= 0 || headerPtr->processCount < 0
+                                         || mdBuffer.length != expectedLength )
+       {
+        // release file, set end state message, return error
+           // function: closeMetaDataBuffer, copyString
+        closeMetaDataBuffer( &mdBuffer );
+        copyString( endStateMsg, "Compiled metadata corrupted header error" );
+        return false;
+       }
+
+    // allocate whole op code table at once
+       // function: malloc
+    opTable.ops = (OpCodeType *)malloc( 
+                               headerPtr->opCount * sizeof( OpCodeType ) );
+
+    if( opTable.ops == NULL )
+       {
+        // release file, set end state message, return error
+           // function: closeMetaDataBuffer, copyString
+        closeMetaDataBuffer( &mdBuffer );
+        copyString( endStateMsg, "Metadata memory allocation error" );
+        return false;
+       }
+
+    opTable.capacity = headerPtr->opCount;
+
+    // set op records following header
+    recordPtr = (const MdbOpRecord *)( headerPtr + 1 );
+
+    // loop across op records, copy to table
+    while( opTable.count < headerPtr->opCount && validFlag && nestFlag )
+       {
+        // check codes still in range
+        validFlag = recordPtr->command < BAD_CMD_CODE 
+                         && recordPtr->inOutArg < BAD_IO_CODE
+                                       && recordPtr->strArg1 < BAD_ARG_CODE;
+
+        // check sys start only first and sys end only last, outside 
+        // any process
+        sysStartFlag = recordPtr->command == SYS_CMD_CODE 
+                                       && recordPtr->strArg1 == START_ARG_CODE;
+        sysEndFlag = recordPtr->command == SYS_CMD_CODE 
+                                         && recordPtr->strArg1 == END_ARG_CODE;
+
+        nestFlag = sysStartFlag == ( opTable.count == 0 )
+                && sysEndFlag == ( opTable.count == headerPtr->opCount - 1 )
+                && ( recordPtr->command != SYS_CMD_CODE 
+                                            || sysStartFlag || sysEndFlag )
+                && !( sysEndFlag && inProcessFlag );
+
+        // check app start outside a process, app end inside one
+        if( recordPtr->command == APP_CMD_CODE )
+           {
+            if( recordPtr->strArg1 == START_ARG_CODE )
+               {
+                nestFlag = nestFlag && !inProcessFlag;
+                inProcessFlag = true;
+                processCount++;
+               }
+
+            else
+               {
+                nestFlag = nestFlag && inProcessFlag 
+                                         && recordPtr->strArg1 == END_ARG_CODE;
+                inProcessFlag = false;
+               }
+           }
+
+        // set table entry from record
+        opTable.ops[ opTable.count ].pid = recordPtr->pid;
+        opTable.ops[ opTable.count ].intArg2 = recordPtr->intArg2;
+        opTable.ops[ opTable.count ].intArg3 = recordPtr->intArg3;
+        opTable.ops[ opTable.count ].opTime = 0;
+        opTable.ops[ opTable.count ].command = recordPtr->command;
+        opTable.ops[ opTable.count ].inOutArg = recordPtr->inOutArg;
+        opTable.ops[ opTable.count ].strArg1 = recordPtr->strArg1;
+        opTable.ops[ opTable.count ].opKind = UNDECODED_OP;
+        opTable.ops[ opTable.count ].lastOpFlag = false;
+
+        // update count and record
+        opTable.count++;
+        recordPtr++;
+       }
+
+    // check processes found against header before release
+    nestFlag = nestFlag && processCount == headerPtr->processCount;
+
+    // release file
+       // function: closeMetaDataBuffer
+    closeMetaDataBuffer( &mdBuffer );
+
+    // check for bad record found
+    if( !validFlag )
+       {
+        // clear table, set end state message, return error
+           // function: clearMetaDataList, copyString
+        clearMetaDataList( opTable.ops );
+        copyString( endStateMsg, "Compiled metadata corrupted op record error" );
+        return false;
+       }
+
+    // check for bad nesting or process count not matching header
+    if( !nestFlag )
+       {
+        // clear table, set end state message, return error
+           // function: clearMetaDataList, copyString
+        clearMetaDataList( opTable.ops );
+        copyString( endStateMsg, 
+                    "Unbalanced start and end arguments in compiled metadata" );
+        return false;
+       }
+
+    // link table entries, assign head to parameter return pointer 
+       // function: linkOpCodeTable
+    *opCodeDataHead = linkOpCodeTable( &opTable );
+
+    // return success
+    return true;
+   }
+
+/*
+Name: isBinaryMetaDataFile
+Process: checks for compiled metadata file name, which must end in ".mdb"
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result of test (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: getStringLength, findSubString
+*/
+bool isBinaryMetaDataFile( const char *fileName )
+   {
+    // find lengths to verify file name
+       // function: getStringLength, findSubString
+    int fileStrLen = getStringLength( fileName );
+    int fileStrSubLoc = findSubString( fileName, ".mdb" );
+
+    // return extension found at end of file name
+    return fileStrSubLoc != SUBSTRING_NOT_FOUND 
+                         && fileStrSubLoc == fileStrLen - MDB_EXTENSION_LEN;
+   }
+
+/*
+Name: writeMetaDataBinary
+Process: writes an op code list as a compiled metadata file:
+         header with counts, then one fixed-width record per op; the
+         process index is rebuilt from the loaded table in one pass
+Function Input/Parameters: file name (const char *),
+                           head of op code list (const OpCodeType *)
+Function Output/Parameters: result message of function state
+                            after completion (char *)
+Function Output/Returned: Boolean result of operation (bool)
+Device Input/device: none
+Device Output/file: compiled metadata file written
+Dependencies: copyString, nextOpCode, fopen, fwrite, fclose
+*/
+bool writeMetaDataBinary( const char *fileName, 
+                           const OpCodeType *metaDataPtr, char *endStateMsg )
+   {
+    // initialize function/variables
+    const char WRITE_BINARY_FLAG[] = "wb";
+    MdbHeaderType header;
+    MdbOpRecord record;
+    const OpCodeType *opPtr;
+    FILE *fileAccessPtr;
+    int index;
+    bool writeFlag = true;
+
+    // set header identification
+    for( index = 0; index < MDB_MAGIC_LEN; index++ )
+       {
+        header.magic[ index ] = MDB_MAGIC[ index ];
+       }
+
+    header.version = MDB_VERSION;
+    header.opCount = 0;
+    header.processCount = 0;
+
+    // loop across op list, count ops and processes
+    for( opPtr = metaDataPtr; opPtr != NULL; opPtr = nextOpCode( opPtr ) )
+       {
+        header.opCount++;
+
+        // check for process start
+        if( opPtr->command == APP_CMD_CODE && opPtr->strArg1 == START_ARG_CODE )
+           {
+            header.processCount++;
+           }
+       }
+
+    // open file for binary writing, check for failure
+       // function: fopen
+    fileAccessPtr = fopen( fileName, WRITE_BINARY_FLAG );
+
+    if( fileAccessPtr == NULL )
+       {
+        // set end state message, return access error
+           // function: copyString
+        copyString( endStateMsg, "Compiled metadata file access error" );
+        return false;
+       }
+
+    // write header
+       // function: fwrite
+    writeFlag = fwrite( &header, sizeof( header ), 1, fileAccessPtr ) == 1;
+
+    // loop across op list, write one record per op
+    for( opPtr = metaDataPtr; opPtr != NULL && writeFlag; 
+                                              opPtr = nextOpCode( opPtr ) )
+       {
+        record.pid = opPtr->pid;
+        record.intArg2 = opPtr->intArg2;
+        record.intArg3 = opPtr->intArg3;
+        record.command = opPtr->command;
+        record.inOutArg = opPtr->inOutArg;
+        record.strArg1 = opPtr->strArg1;
+        record.reserved = 0;
+
+        // function: fwrite
+        writeFlag = fwrite( &record, sizeof( record ), 1, fileAccessPtr ) == 1;
+       }
+
+    // close file, check for write failure
+       // function: fclose
+    writeFlag = fclose( fileAccessPtr ) == 0 && writeFlag;
+
+    // set end state message
+       // function: copyString
+    if( writeFlag )
+       {
+        copyString( endStateMsg, "Compiled metadata file write successful" );
+       }
+
+    else
+       {
+        copyString( endStateMsg, "Compiled metadata file write error" );
+       }
+
+    // return result of operation
+    return writeFlag;
+   }
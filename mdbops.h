@@ -0,0 +1,79 @@
+// protect from multiple compiling 
+#ifndef MDB_OPS_H
+#define MDB_OPS_H
+
+// header files
+#include "datatypes.h"
+#include "StandardConstants.h"
+#include "StringUtils.h"
+#include "metadataops.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// constants
+
+// compiled metadata file identification
+#define MDB_MAGIC "MDB1"
+#define MDB_VERSION 2
+
+typedef enum { MDB_MAGIC_LEN = 4, 
+               MDB_EXTENSION_LEN = 4 } MdbConstants;
+
+// compiled metadata file header, native byte order
+typedef struct MdbHeaderType
+{
+    char magic[MDB_MAGIC_LEN];
+    int version;
+    int opCount;
+    int processCount;
+} MdbHeaderType;
+
+// fixed-width op record, interned codes from OpCodeType
+typedef struct MdbOpRecord
+{
+    int pid;
+    int intArg2;
+    int intArg3;
+    unsigned char command;
+    unsigned char inOutArg;
+    unsigned char strArg1;
+    unsigned char reserved;
+} MdbOpRecord;
+
+// Function prototypes
+
+/*
+ Name: getMetaDataBinary
+ Process: maps a compiled metadata file and builds the op code table
+          from its fixed-width records, no text parsing, checking codes
+          and start/end nesting in the same pass
+ Function Input/Parameters: file name (const char *)
+ Function Output/Parameters: pointer to op code list head pointer (OpCodeType **),
+                             result message of function state after completion (char *)
+ Function Output/Returned: Boolean result of operation (bool)
+ */
+bool getMetaDataBinary( const char *fileName, 
+                               OpCodeType **opCodeDataHead, char *endStateMsg );
+
+/*
+ Name: isBinaryMetaDataFile
+ Process: checks for compiled metadata ".mdb" file name extension
+ Function Input/Parameters: file name (const char *)
+ Function Output/Returned: Boolean result of test (bool)
+ */
+bool isBinaryMetaDataFile( const char *fileName );
+
+/*
+ Name: writeMetaDataBinary
+ Process: writes an op code list as a compiled metadata file,
+          header, then op records
+ Function Input/Parameters: file name (const char *),
+                            head of op code list (const OpCodeType *)
+ Function Output/Parameters: result message of function state after completion (char *)
+ Function Output/Returned: Boolean result of operation (bool)
+ */
+bool writeMetaDataBinary( const char *fileName, 
+                          const OpCodeType *metaDataPtr, char *endStateMsg );
+
+#endif // MDB_OPS_H
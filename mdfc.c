@@ -0,0 +1,61 @@
+// header files
+#include "mdbops.h"
+#include "metadataops.h"
+#include "StringUtils.h"
+
+// Constants
+typedef enum { MDFC_NUM_ARGS = 3 } MDFC_CONSTANTS;
+
+/*
+Name: main
+Process: metadata compiler driver, validates a text metadata file with the
+         same op command rules as the simulator, then writes it
+         as a compiled metadata file for direct loading
+Function Input/Parameters: number of arguments (int),
+                           vector of arguments (char **)
+Function Output/Parameters: none
+Function Output/Returned: zero on success, one on failure (int)
+Device Input/file: metadata file uploaded
+Device Output/file: compiled metadata file written
+Dependencies: printf, getMetaDataParallel, writeMetaDataBinary, clearMetaDataList
+*/
+int main( int argc, char **argv )
+   {
+    // initialize function/variables
+    OpCodeType *metaDataPtr = NULL;
+    char errorMessage[ MAX_STR_LEN ];
+    bool compileSuccess = false;
+
+    // check for input and output file names
+    if( argc != MDFC_NUM_ARGS )
+       {
+        // show command line format, return failure
+           // function: printf
+        printf( "Command Line Format:\n" );
+        printf( "     mdfc <metadata file name> <compiled file name>\n" );
+        return 1;
+       }
+
+    // upload and validate metadata file, check for success
+       // function: getMetaDataParallel
+    if( getMetaDataParallel( argv[ 1 ], &metaDataPtr, errorMessage, 0 ) 
+                                                        && metaDataPtr != NULL )
+       {
+        // write compiled file, check for success
+           // function: writeMetaDataBinary
+        compileSuccess = writeMetaDataBinary( argv[ 2 ], 
+                                                   metaDataPtr, errorMessage );
+       }
+
+    // show result
+       // function: printf
+    printf( "%s: %s\n", compileSuccess ? "Compiled" : "Compile Error", 
+                                                                 errorMessage );
+
+    // clean up metadata
+       // function: clearMetaDataList
+    metaDataPtr = clearMetaDataList( metaDataPtr );
+
+    // return result
+    return compileSuccess ? 0 : 1;
+   }
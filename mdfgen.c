@@ -0,0 +1,534 @@
+// header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "StandardConstants.h"
+#include "StringUtils.h"
+
+// Constants
+typedef enum { MDFGEN_MIN_ARGS = 2,
+               DEFAULT_NUM_PROCESSES = 5,
+               DEFAULT_OPS_PER_PROCESS = 10,
+               DEFAULT_MAX_CYCLES = 20,
+               DEFAULT_CPU_RATIO = 5,
+               DEFAULT_DEV_RATIO = 3,
+               DEFAULT_MEM_RATIO = 2,
+               DEFAULT_SEED = 1,
+               GEN_MEM_AVAILABLE = 102400,
+               GEN_MEM_BLOCK_UNIT = 100,
+               GEN_PROC_CYCLE_RATE = 10,
+               GEN_IO_CYCLE_RATE = 20,
+               GEN_QUANTUM_CYCLES = 3 } MDFGEN_CONSTANTS;
+
+// cycle count distributions
+typedef enum { UNIFORM_DIST,
+               EXPONENTIAL_DIST,
+               HEAVY_TAIL_DIST,
+               BAD_DIST } CycleDistCodes;
+
+// generator settings from the command line
+typedef struct GenSettingsType
+   {
+    long numProcesses;
+    int opsPerProcess;
+    int maxCycles;
+    int cpuRatio;
+    int devRatio;
+    int memRatio;
+    int distCode;
+    unsigned long long seed;
+    char schedCode[ MIN_STR_LEN ];
+    char logTo[ MIN_STR_LEN ];
+    char baseName[ MAX_STR_LEN ];
+   } GenSettingsType;
+
+// device names accepted as first string arguments, by direction
+static const char * const IN_DEVICES[] = { "ethernet", "hard drive",
+                                           "keyboard", "serial",
+                                           "sound signal", "usb",
+                                           "video signal" };
+
+static const char * const OUT_DEVICES[] = { "ethernet", "hard drive",
+                                            "monitor", "printer", "serial",
+                                            "sound signal", "usb",
+                                            "video signal" };
+
+// Function prototypes
+int getCycleCount( unsigned long long *statePtr,
+                                     const GenSettingsType *settingsPtr );
+unsigned long long getRandom( unsigned long long *statePtr );
+double getRandomUnit( unsigned long long *statePtr );
+bool processGenCmdLine( int numArgs, char **strVector,
+                                              GenSettingsType *settingsPtr );
+void showGenCommandLineFormat();
+bool writeGenConfig( const GenSettingsType *settingsPtr );
+bool writeGenMetaData( const GenSettingsType *settingsPtr );
+
+/*
+Name: main
+Process: synthetic workload generator driver, writes a valid metadata
+         file and a matching config file from the command line settings;
+         the same settings and seed always give the same files
+Function Input/Parameters: number of arguments (int),
+                           vector of arguments (char **)
+Function Output/Parameters: none
+Function Output/Returned: zero on success, one on failure (int)
+Device Input/device: none
+Device Output/file: metadata and config files written
+Dependencies: processGenCmdLine, showGenCommandLineFormat, writeGenMetaData,
+              writeGenConfig, printf
+*/
+int main( int argc, char **argv )
+   {
+    // initialize function/variables
+    GenSettingsType settings;
+
+    // get settings, check for bad command line
+       // function: processGenCmdLine, showGenCommandLineFormat
+    if( !processGenCmdLine( argc, argv, &settings ) )
+       {
+        showGenCommandLineFormat();
+        return 1;
+       }
+
+    // write metadata file then config file, check for success
+       // function: writeGenMetaData, writeGenConfig
+    if( !writeGenMetaData( &settings ) || !writeGenConfig( &settings ) )
+       {
+        // display failure, return failure
+           // function: printf
+        printf( "Generated: file write error for %s\n", settings.baseName );
+        return 1;
+       }
+
+    // display success, return success
+       // function: printf
+    printf( "Generated: %s.mdf and %s.cnf, %ld processes\n",
+                  settings.baseName, settings.baseName, settings.numProcesses );
+    return 0;
+   }
+
+/*
+Name: getCycleCount
+Process: draws one cycle count from the selected distribution,
+         uniform over one to maximum, exponential with mean of one quarter
+         the maximum, or heavy tailed (Pareto, shape 1.2) starting at one;
+         all are clamped to one through maximum
+Function Input/Parameters: pointer to random state (unsigned long long *),
+                           pointer to settings (const GenSettingsType *)
+Function Output/Parameters: updated random state (unsigned long long *)
+Function Output/Returned: cycle count (int)
+Device Input/device: none
+Device Output/device: none
+Dependencies: getRandom, getRandomUnit, log, pow
+*/
+int getCycleCount( unsigned long long *statePtr,
+                                      const GenSettingsType *settingsPtr )
+   {
+    // initialize function/variables
+    const double PARETO_SHAPE = 1.2;
+    double cycles;
+
+    // draw by distribution
+       // function: getRandom, getRandomUnit, log, pow
+    switch( settingsPtr->distCode )
+       {
+        case EXPONENTIAL_DIST:
+
+           cycles = 1.0 - log( 1.0 - getRandomUnit( statePtr ) )
+                                              * settingsPtr->maxCycles / 4.0;
+           break;
+
+        case HEAVY_TAIL_DIST:
+
+           cycles = pow( 1.0 - getRandomUnit( statePtr ),
+                                                       -1.0 / PARETO_SHAPE );
+           break;
+
+        default:
+
+           cycles = 1.0 + (double)( getRandom( statePtr )
+                             % (unsigned long long)settingsPtr->maxCycles );
+           break;
+       }
+
+    // clamp to valid cycle range
+    if( cycles > settingsPtr->maxCycles )
+       {
+        cycles = settingsPtr->maxCycles;
+       }
+
+    // return whole cycle count
+    return (int)cycles;
+   }
+
+/*
+Name: getRandom
+Process: xorshift64* generator, used instead of rand so a seed
+         gives the same files on every platform
+Function Input/Parameters: pointer to random state (unsigned long long *)
+Function Output/Parameters: updated random state (unsigned long long *)
+Function Output/Returned: next random value (unsigned long long)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+unsigned long long getRandom( unsigned long long *statePtr )
+   {
+    // advance state
+    *statePtr ^= *statePtr >> 12;
+    *statePtr ^= *statePtr << 25;
+    *statePtr ^= *statePtr >> 27;
+
+    // return scrambled state
+    return *statePtr * 2685821657736338717ULL;
+   }
+
+/*
+Name: getRandomUnit
+Process: random value in the range zero up to but not including one
+Function Input/Parameters: pointer to random state (unsigned long long *)
+Function Output/Parameters: updated random state (unsigned long long *)
+Function Output/Returned: random fraction (double)
+Device Input/device: none
+Device Output/device: none
+Dependencies: getRandom
+*/
+double getRandomUnit( unsigned long long *statePtr )
+   {
+    // use upper 53 bits as the fraction
+       // function: getRandom
+    return ( getRandom( statePtr ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+   }
+
+/*
+Name: processGenCmdLine
+Process: sets defaults, then reads option pairs and the output base name,
+         checks each value for range
+Function Input/Parameters: number of arguments (int),
+                           vector of arguments (char **)
+Function Output/Parameters: pointer to settings (GenSettingsType *)
+Function Output/Returned: Boolean result of argument capture,
+                          true if valid (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: copyString, compareString, getStringLength, strtol, strtoull
+*/
+bool processGenCmdLine( int numArgs, char **strVector,
+                                               GenSettingsType *settingsPtr )
+   {
+    // initialize function/variables
+    int argIndex = 1;
+    int ratioCount;
+    const char *option, *value;
+
+    // set defaults
+    settingsPtr->numProcesses = DEFAULT_NUM_PROCESSES;
+    settingsPtr->opsPerProcess = DEFAULT_OPS_PER_PROCESS;
+    settingsPtr->maxCycles = DEFAULT_MAX_CYCLES;
+    settingsPtr->cpuRatio = DEFAULT_CPU_RATIO;
+    settingsPtr->devRatio = DEFAULT_DEV_RATIO;
+    settingsPtr->memRatio = DEFAULT_MEM_RATIO;
+    settingsPtr->distCode = UNIFORM_DIST;
+    settingsPtr->seed = DEFAULT_SEED;
+    copyString( settingsPtr->schedCode, "FCFS-N" );
+    copyString( settingsPtr->logTo, "Monitor" );
+    settingsPtr->baseName[ 0 ] = NULL_CHAR;
+
+    // check for minimum number of arguments
+    if( numArgs < MDFGEN_MIN_ARGS )
+       {
+        return false;
+       }
+
+    // loop across option pairs before base name
+       // function: compareString, strtol, strtoull, copyString
+    while( argIndex < numArgs - 1 )
+       {
+        option = strVector[ argIndex ];
+        value = strVector[ argIndex + 1 ];
+
+        if( compareString( option, "-p" ) == STR_EQ )
+           {
+            settingsPtr->numProcesses = strtol( value, NULL, 10 );
+           }
+
+        else if( compareString( option, "-o" ) == STR_EQ )
+           {
+            settingsPtr->opsPerProcess = (int)strtol( value, NULL, 10 );
+           }
+
+        else if( compareString( option, "-x" ) == STR_EQ )
+           {
+            settingsPtr->maxCycles = (int)strtol( value, NULL, 10 );
+           }
+
+        else if( compareString( option, "-m" ) == STR_EQ )
+           {
+            ratioCount = sscanf( value, "%d:%d:%d", &settingsPtr->cpuRatio,
+                            &settingsPtr->devRatio, &settingsPtr->memRatio );
+
+            if( ratioCount != 3 )
+               {
+                return false;
+               }
+           }
+
+        else if( compareString( option, "-d" ) == STR_EQ )
+           {
+            settingsPtr->distCode
+                   = compareString( value, "uniform" ) == STR_EQ ? UNIFORM_DIST
+                   : compareString( value, "exp" ) == STR_EQ ? EXPONENTIAL_DIST
+                   : compareString( value, "heavy" ) == STR_EQ ? HEAVY_TAIL_DIST
+                   : BAD_DIST;
+           }
+
+        else if( compareString( option, "-s" ) == STR_EQ )
+           {
+            settingsPtr->seed = strtoull( value, NULL, 10 );
+           }
+
+        else if( compareString( option, "-c" ) == STR_EQ
+                                  && getStringLength( value ) < MIN_STR_LEN )
+           {
+            copyString( settingsPtr->schedCode, value );
+           }
+
+        else if( compareString( option, "-l" ) == STR_EQ
+                                  && getStringLength( value ) < MIN_STR_LEN )
+           {
+            copyString( settingsPtr->logTo, value );
+           }
+
+        else
+           {
+            return false;
+           }
+
+        argIndex = argIndex + 2;
+       }
+
+    // check for base name as last argument
+       // function: getStringLength, copyString
+    if( argIndex != numArgs - 1 || strVector[ argIndex ][ 0 ] == '-'
+              || getStringLength( strVector[ argIndex ] ) >= MAX_STR_LEN )
+       {
+        return false;
+       }
+
+    copyString( settingsPtr->baseName, strVector[ argIndex ] );
+
+    // a zero seed would stall the generator
+    if( settingsPtr->seed == 0 )
+       {
+        settingsPtr->seed = DEFAULT_SEED;
+       }
+
+    // return range check of settings
+    return settingsPtr->numProcesses > 0 && settingsPtr->opsPerProcess > 0
+        && settingsPtr->maxCycles > 0 && settingsPtr->distCode != BAD_DIST
+        && settingsPtr->cpuRatio >= 0 && settingsPtr->devRatio >= 0
+        && settingsPtr->memRatio >= 0
+        && settingsPtr->cpuRatio + settingsPtr->devRatio
+                                                + settingsPtr->memRatio > 0;
+   }
+
+/*
+Name: showGenCommandLineFormat
+Process: displays command line format as assistance to user
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/monitor: data displayed as specified
+Dependencies: printf
+*/
+void showGenCommandLineFormat()
+   {
+    // display command line format
+       // function: printf
+    printf( "Command Line Format:\n" );
+    printf( "     mdfgen [-p n] [-o n] [-m c:d:m] [-d dist] [-x n] [-s n]\n" );
+    printf( "            [-c code] [-l logto] <output base name>\n" );
+    printf( "     -p number of processes, default 5\n" );
+    printf( "     -o ops per process, default 10\n" );
+    printf( "     -m cpu:dev:mem op mix ratio, default 5:3:2\n" );
+    printf( "     -d cycle distribution uniform, exp or heavy, "
+                                                    "default uniform\n" );
+    printf( "     -x maximum cycles per op, default 20\n" );
+    printf( "     -s random seed, default 1\n" );
+    printf( "     -c config CPU scheduling code, default FCFS-N\n" );
+    printf( "     -l config log to setting, default Monitor\n" );
+    printf( "     writes <base>.mdf and <base>.cnf\n" );
+   }
+
+/*
+Name: writeGenConfig
+Process: writes a config file naming the generated metadata file,
+         with memory sized for the generated allocations
+Function Input/Parameters: pointer to settings (const GenSettingsType *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result of file write (bool)
+Device Input/device: none
+Device Output/file: config file written
+Dependencies: snprintf, fopen, fprintf, fclose
+*/
+bool writeGenConfig( const GenSettingsType *settingsPtr )
+   {
+    // initialize function/variables
+    char fileName[ MAX_STR_LEN + MIN_STR_LEN ];
+    FILE *outFile;
+
+    // open config file
+       // function: snprintf, fopen
+    snprintf( fileName, sizeof( fileName ), "%s.cnf", settingsPtr->baseName );
+    outFile = fopen( fileName, "w" );
+
+    if( outFile == NULL )
+       {
+        return false;
+       }
+
+    // write config lines
+       // function: fprintf
+    fprintf( outFile, "Start Simulator Configuration File:\n" );
+    fprintf( outFile, "Version/Phase                     : 1.05\n" );
+    fprintf( outFile, "File Path                         : %s.mdf\n",
+                                                       settingsPtr->baseName );
+    fprintf( outFile, "CPU Scheduling Code               : %s\n",
+                                                      settingsPtr->schedCode );
+    fprintf( outFile, "Quantum Time (cycles)             : %d\n",
+                                                          GEN_QUANTUM_CYCLES );
+    fprintf( outFile, "Memory Available (KB)             : %d\n",
+                                                           GEN_MEM_AVAILABLE );
+    fprintf( outFile, "Memory Display (On/Off)           : Off\n" );
+    fprintf( outFile, "Processor Cycle Time (msec)       : %d\n",
+                                                         GEN_PROC_CYCLE_RATE );
+    fprintf( outFile, "I/O Cycle Time (msec)             : %d\n",
+                                                           GEN_IO_CYCLE_RATE );
+    fprintf( outFile, "Log To                            : %s\n",
+                                                          settingsPtr->logTo );
+    fprintf( outFile, "Log File Path                     : %s.lgf\n",
+                                                       settingsPtr->baseName );
+    fprintf( outFile, "End Simulator Configuration File.\n" );
+
+    // close file, return success
+       // function: fclose
+    return fclose( outFile ) == 0;
+   }
+
+/*
+Name: writeGenMetaData
+Process: writes the metadata file; each process is app start, the op
+         count of ops drawn by mix ratio, then app end; device ops pick
+         a device for their direction, the first memory op of a process
+         allocates a block and later memory ops access inside it
+Function Input/Parameters: pointer to settings (const GenSettingsType *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result of file write (bool)
+Device Input/device: none
+Device Output/file: metadata file written
+Dependencies: snprintf, fopen, fprintf, getRandom, getCycleCount, fclose
+*/
+bool writeGenMetaData( const GenSettingsType *settingsPtr )
+   {
+    // initialize function/variables
+    const int NUM_IN_DEVICES = sizeof( IN_DEVICES ) / sizeof( IN_DEVICES[ 0 ] );
+    const int NUM_OUT_DEVICES
+                          = sizeof( OUT_DEVICES ) / sizeof( OUT_DEVICES[ 0 ] );
+    const int NUM_MEM_BLOCKS = GEN_MEM_AVAILABLE / GEN_MEM_BLOCK_UNIT;
+    int ratioTotal = settingsPtr->cpuRatio + settingsPtr->devRatio
+                                                    + settingsPtr->memRatio;
+    unsigned long long randState = settingsPtr->seed;
+    char fileName[ MAX_STR_LEN + MIN_STR_LEN ];
+    FILE *outFile;
+    long procIndex;
+    int opIndex, pick, memBase = 0, memSize = 0;
+
+    // open metadata file
+       // function: snprintf, fopen
+    snprintf( fileName, sizeof( fileName ), "%s.mdf", settingsPtr->baseName );
+    outFile = fopen( fileName, "w" );
+
+    if( outFile == NULL )
+       {
+        return false;
+       }
+
+    // write leader and system start
+       // function: fprintf
+    fprintf( outFile, "Start Program Meta-Data Code:\nsys start\n" );
+
+    // loop across processes
+    for( procIndex = 0; procIndex < settingsPtr->numProcesses; procIndex++ )
+       {
+        fprintf( outFile, "app start, 0\n" );
+        memSize = 0;
+
+        // loop across process ops
+        for( opIndex = 0; opIndex < settingsPtr->opsPerProcess; opIndex++ )
+           {
+            // pick op kind by mix ratio
+               // function: getRandom
+            pick = (int)( getRandom( &randState ) % ratioTotal );
+
+            // check for cpu op
+               // function: getCycleCount
+            if( pick < settingsPtr->cpuRatio )
+               {
+                fprintf( outFile, "cpu process, %d\n",
+                                   getCycleCount( &randState, settingsPtr ) );
+               }
+
+            // otherwise, check for device op, pick direction then device
+               // function: getRandom, getCycleCount
+            else if( pick < settingsPtr->cpuRatio + settingsPtr->devRatio )
+               {
+                if( getRandom( &randState ) % 2 == 0 )
+                   {
+                    fprintf( outFile, "dev in, %s, %d\n",
+                       IN_DEVICES[ getRandom( &randState ) % NUM_IN_DEVICES ],
+                                   getCycleCount( &randState, settingsPtr ) );
+                   }
+
+                else
+                   {
+                    fprintf( outFile, "dev out, %s, %d\n",
+                     OUT_DEVICES[ getRandom( &randState ) % NUM_OUT_DEVICES ],
+                                   getCycleCount( &randState, settingsPtr ) );
+                   }
+               }
+
+            // otherwise, check for first memory op, allocate block
+               // function: getRandom
+            else if( memSize == 0 )
+               {
+                memBase = (int)( getRandom( &randState ) % NUM_MEM_BLOCKS )
+                                                        * GEN_MEM_BLOCK_UNIT;
+                memSize = (int)( 1 + getRandom( &randState )
+                                       % ( NUM_MEM_BLOCKS / 16 ) )
+                                                        * GEN_MEM_BLOCK_UNIT;
+                fprintf( outFile, "mem allocate, %d, %d\n", memBase, memSize );
+               }
+
+            // otherwise, assume access inside allocated block
+               // function: getRandom
+            else
+               {
+                pick = (int)( getRandom( &randState ) % memSize );
+                fprintf( outFile, "mem access, %d, %d\n", memBase + pick,
+                     (int)( 1 + getRandom( &randState ) % ( memSize - pick ) ) );
+               }
+           }
+
+        fprintf( outFile, "app end\n" );
+       }
+
+    // write system end and trailer
+       // function: fprintf
+    fprintf( outFile, "sys end\nEnd Program Meta-Data Code.\n" );
+
+    // close file, return success
+       // function: fclose
+    return fclose( outFile ) == 0;
+   }
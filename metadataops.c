@@ -1,59 +1,171 @@
+// POSIX support for file mapping
+#define _POSIX_C_SOURCE 200809L
+
 // header files
 #include "metadataops.h"
 #include "StringUtils.h"
 #include "StandardConstants.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// display tables for interned op code members, indexed by code
+static const char *COMMAND_STRINGS[] = { "sys", "app", "cpu", "mem", "dev" };
+static const char *IN_OUT_STRINGS[] = { "", "in", "out" };
+static const char *STR_ARG_STRINGS[] = { "access", "allocate", "end", 
+                                         "ethernet", "hard drive", "keyboard",
+                                         "monitor", "printer", "process",
+                                         "serial", "sound signal", "start",
+                                         "usb", "video signal" };
 
 /*
-Name: addNode
-Process: adds metadata node to linked list recursively,
-         handles empty list condition
-Function Input/Parameters: pointer to head or next linked node (OpCodeType *),
-                           pointer to new node (OpCodeType *)
-Function Output/Parameters: none
-Function Output/Returned: pointer to previous node, or head node (OpCodeType *)
+Name: addOpCode
+Process: appends a copy of an op code to the end of the op code table,
+         doubling table capacity when full so loading is linear
+Function Input/Parameters: pointer to op code table (OpCodeTable *),
+                           pointer to new op code (const OpCodeType *)
+Function Output/Parameters: updated op code table (OpCodeTable *)
+Function Output/Returned: Boolean result of allocation, 
+                          false if table could not grow (bool)
 Device Input/file: none
 Device Output/device: none
-Dependencies: malloc, copyString
+Dependencies: realloc
 */
-OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode )
+bool addOpCode( OpCodeTable *table, const OpCodeType *newNode )
    {
-    // check for local pointer assigned to null
-    if( localPtr == NULL )
-       { 
-        // access memory for new link/node 
-           // function: malloc
-        localPtr = (OpCodeType *) malloc( sizeof( OpCodeType ) ); 
+    // initialize function/variables
 
-        // assign all three values to newly created node 
-        // assign next pointer to null
-           // function: copyString
-        localPtr->pid = newNode->pid;
-        copyString( localPtr->command, newNode->command );
-        copyString( localPtr->inOutArg, newNode->inOutArg );
-        copyString( localPtr->strArg1, newNode->strArg1 );
-        localPtr->intArg2 = newNode->intArg2;
-        localPtr->intArg3 = newNode->intArg3;
-        localPtr->opEndTime = newNode->opEndTime;
-
-        localPtr->nextNode = NULL;
-       
-        // return current local pointer
-        return localPtr;
-       } 
+       // initialize first table capacity
+       const int INIT_TABLE_CAPACITY = 64;
+
+       // initialize other variables
+       int newCapacity;
+       OpCodeType *newOps;
+
+    // check for full table
+    if( table->count == table->capacity )
+       {
+        // double capacity, or set initial capacity
+        newCapacity = table->capacity == 0 
+                                ? INIT_TABLE_CAPACITY : table->capacity * 2;
+
+        // grow table
+           // function: realloc
+        newOps = (OpCodeType *)realloc( table->ops, 
+                                          newCapacity * sizeof( OpCodeType ) );
+
+        // check for allocation failure
+        if( newOps == NULL )
+           {
+            // return failed operation, table unchanged
+            return false;
+           }
+
+        // assign grown table
+        table->ops = newOps;
+        table->capacity = newCapacity;
+       }
+
+    // copy op code to end of table, increment count
+    table->ops[ table->count ] = *newNode;
+    table->ops[ table->count ].lastOpFlag = false;
+    table->count++;
+
+    // return successful operation
+    return true;
+   }
+
+/*
+Name: buildProcessIndex
+Process: load time index pass; walks the op code list once, handing
+         each app start op to indexProcess, which consumes the process
+         ops and returns the op after its app end, so each op is visited
+         one time; index capacity doubles when full
+Function Input/Parameters: head of op code list (OpCodeType *)
+Function Output/Parameters: pointer to empty process index (ProcessIndexTable *)
+Function Output/Returned: Boolean result of allocation, 
+                          false if index could not grow (bool)
+Device Input/file: none
+Device Output/device: none
+Dependencies: realloc, indexProcess, nextOpCode
+*/
+bool buildProcessIndex( OpCodeType *opCodeDataHead, 
+                                               ProcessIndexTable *indexPtr )
+   {
+    // initialize function/variables
+
+       // initialize first index capacity
+       const int INIT_INDEX_CAPACITY = 16;
+
+       // initialize other variables
+       OpCodeType *opPtr = opCodeDataHead;
+       ProcessIndexType *newProcs;
+       int opIndex = 0, newCapacity;
+
+    // set empty index
+    indexPtr->procs = NULL;
+    indexPtr->count = 0;
+    indexPtr->capacity = 0;
 
-    // assume end of list not found yet
-    // assign recursive function to current's next link 
-       // function: addNode 
-    localPtr->nextNode = addNode( localPtr->nextNode, newNode );
+    // loop across op code list
+    while( opPtr != NULL )
+       {
+        // check for app start op
+        if( opPtr->command == APP_CMD_CODE 
+                                        && opPtr->strArg1 == START_ARG_CODE )
+           {
+            // check for full index
+            if( indexPtr->count == indexPtr->capacity )
+               {
+                // double capacity, or set initial capacity
+                newCapacity = indexPtr->capacity == 0 
+                               ? INIT_INDEX_CAPACITY : indexPtr->capacity * 2;
+
+                // grow index
+                   // function: realloc
+                newProcs = (ProcessIndexType *)realloc( indexPtr->procs, 
+                                   newCapacity * sizeof( ProcessIndexType ) );
+
+                // check for allocation failure
+                if( newProcs == NULL )
+                   {
+                    // return failed operation, index holds prior processes
+                    return false;
+                   }
+
+                // assign grown index
+                indexPtr->procs = newProcs;
+                indexPtr->capacity = newCapacity;
+               }
+
+            // index process, continue after it
+               // function: indexProcess
+            opPtr = indexProcess( opPtr, opIndex, 
+                                        &indexPtr->procs[ indexPtr->count ] );
+            opIndex = opIndex + indexPtr->procs[ indexPtr->count ].opCount;
+            indexPtr->count++;
+           }
+
+        // otherwise, assume op outside a process
+        else
+           {
+            // update op pointer and position
+               // function: nextOpCode
+            opPtr = nextOpCode( opPtr );
+            opIndex++;
+           }
+       }
 
-    // return current local pointer
-    return localPtr;
+    // return successful operation
+    return true;
    }
 
 /*
 Name: clearMetaDataList
-Process: recursively traverses list, frees dynamically allocated nodes
-Function Input/Parameters: node op code (const OpCodeType *)
+Process: frees the op code table in one call; the list head is always
+         the first entry of the table built by getMetaData
+Function Input/Parameters: head of op code list (OpCodeType *)
 Function Output/Parameters: none
 Function Output/Returned: NULL (OpCodeType *)
 Device Input/file: none
@@ -62,25 +174,138 @@ Dependencies: free
 */
 OpCodeType *clearMetaDataList( OpCodeType *localPtr )
    {
-    // check for local pointer not set to null (list not empty)
-    if( localPtr != NULL )
-       {
-        // call recursive function with next pointer 
-           // function: clearMetaDataList
-        clearMetaDataList( localPtr->nextNode );
-
-        // after recursive call, release memory to OS 
-           // function: free
-        free( localPtr );
-      
-        // set given pointer to NULL
-        localPtr = NULL;
-       } 
+    // release table memory, free ignores empty list
+       // function: free
+    free( localPtr );
 
     // return null to calling function
     return NULL;
+   }
+
+/*
+Name: clearProcessIndex
+Process: frees the process index entries; the op codes they point to
+         belong to the op code table and are not released
+Function Input/Parameters: pointer to process index (ProcessIndexTable *)
+Function Output/Parameters: empty process index (ProcessIndexTable *)
+Function Output/Returned: none
+Device Input/file: none
+Device Output/device: none
+Dependencies: free
+*/
+void clearProcessIndex( ProcessIndexTable *indexPtr )
+   {
+    // release index memory
+       // function: free
+    free( indexPtr->procs );
+
+    // set index to empty
+    indexPtr->procs = NULL;
+    indexPtr->count = 0;
+    indexPtr->capacity = 0;
+   }
+
+/*
+Name: closeMetaDataBuffer
+Process: releases metadata buffer contents, unmapping mapped files
+         and freeing stream read buffers
+Function Input/Parameters: pointer to metadata buffer (MetaDataBuffer *)
+Function Output/Parameters: cleared metadata buffer (MetaDataBuffer *)
+Function Output/Returned: none
+Device Input/file: none
+Device Output/device: none
+Dependencies: munmap, free
+*/
+void closeMetaDataBuffer( MetaDataBuffer *mdBuffer )
+   {
+    // check for buffer data to release
+    if( mdBuffer->data != NULL )
+       {
+        // check for mapped file
+        if( mdBuffer->mappedFlag )
+           {
+            // release mapping
+               // function: munmap
+            munmap( (void *)mdBuffer->data, mdBuffer->length );
+           }
+
+        // otherwise, assume stream read buffer
+        else
+           {
+            // release buffer memory
+               // function: free
+            free( (void *)mdBuffer->data );
+           }
+       }
+
+    // set buffer to empty
+    mdBuffer->data = NULL;
+    mdBuffer->length = 0;
+    mdBuffer->position = 0;
+    mdBuffer->mappedFlag = false;
+   }
+
+/*
+Name: commandCodeToString
+Process: converts an interned op command code to its display string
+Function Input/Parameters: op command code (int)
+Function Output/Parameters: none
+Function Output/Returned: display string, empty if code invalid (const char *)
+Device Input/file: none
+Device Output/device: none
+Dependencies: none
+*/
+const char *commandCodeToString( int code )
+   {
+    // check for code in table range
+    if( code >= SYS_CMD_CODE && code < BAD_CMD_CODE )
+       {
+        // return table string
+        return COMMAND_STRINGS[ code ];
+       }
+
+    // return empty string
+    return "";
+   }
+
+/*
+Name: compareViewString
+Process: compares a buffer view with a c-style string,
+         results are the same as compareString
+Function Input/Parameters: view into metadata buffer (MetaDataView),
+                           c-style test string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: difference of first unequal characters,
+                          or difference in lengths, zero if equal (int)
+Device Input/file: none
+Device Output/device: none
+Dependencies: getStringLength
+*/
+int compareViewString( MetaDataView testView, const char *otherStr )
+   {
+    // initialize function/variables
+    int diff, index = 0;
+
+    // loop to end of view
+    while( index < testView.length )
+       {
+        // get difference in characters
+        diff = testView.str[ index ] - otherStr[ index ];
+
+        // check for difference between characters
+        if( diff != 0 )
+           {
+            // return difference
+            return diff;
+           }
+
+        // increment index
+        index++;
+       }
 
-    return NULL;// temporary stub function 
+    // return difference in lengths, if any
+       // function: getStringLength
+    return testView.length - getStringLength( otherStr );
    }
 
 /*
@@ -92,7 +317,8 @@ Function Output/Parameters: none
 Function Output/Returned: calculated time (int)
 Device Input/file: none
 Device Output/device: none
-Dependencies: printf, compareString
+Dependencies: printf, commandCodeToString, inOutCodeToString, 
+              strArgCodeToString, nextOpCode
 */
 void displayMetaData( const OpCodeType *localPtr )
    {
@@ -114,14 +340,15 @@ void displayMetaData( const OpCodeType *localPtr )
 
        // print op code command 
           // function: printf
-       printf( "/cmd: %s", localPtr->command );
+          // function: commandCodeToString
+       printf( "/cmd: %s", commandCodeToString( localPtr->command ) );
 
        // check for dev op
-       if( compareString(localPtr->command, "dev" ) == STR_EQ )
+       if( localPtr->command == DEV_CMD_CODE )
           {
            // print in/out parameter 
-              // function: printf
-           printf( "/io: %s", localPtr->inOutArg );
+              // function: printf, inOutCodeToString
+           printf( "/io: %s", inOutCodeToString( localPtr->inOutArg ) );
           }
        
        // otherwise assume other than dev 
@@ -133,8 +360,8 @@ void displayMetaData( const OpCodeType *localPtr )
           }
        
        // print first string argument 
-          // function: printf 
-       printf( "\n\t /arg1: %s", localPtr->strArg1 );
+          // function: printf, strArgCodeToString 
+       printf( "\n\t /arg1: %s", strArgCodeToString( localPtr->strArg1 ) );
 
        // print first in argument 
           // function: printf
@@ -144,55 +371,199 @@ void displayMetaData( const OpCodeType *localPtr )
           // function: printf
        printf( "/arg3: %d", localPtr->intArg3 );
 
-       // print op end time
-       printf( "/op end time: %8.6f", localPtr->opEndTime ); 
-
        // end line 
           // funciton: printf
        printf( "\n\n" );
 
        // assign local pointer to next node
-       localPtr = localPtr->nextNode;
+          // function: nextOpCode
+       localPtr = nextOpCode( localPtr );
       }
    }
 
+/*
+Name: finishMetaDataStream
+Process: cancels and joins the stream loader thread, releases any
+         queued process blocks not taken by the simulator,
+         and reports the load result
+Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+Function Output/Parameters: result message of loading (char *)
+Function Output/Returned: Boolean result of loading (bool)
+Device Input/file: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_broadcast, 
+              pthread_mutex_unlock, pthread_join, clearMetaDataList,
+              pthread_mutex_destroy, pthread_cond_destroy, 
+              closeMetaDataBuffer, copyString
+*/
+bool finishMetaDataStream( MetaDataStream *streamPtr, char *endStateMsg )
+   {
+    // set cancel flag, wake loader if waiting on full queue
+       // function: pthread_mutex_lock, pthread_cond_broadcast,
+       //           pthread_mutex_unlock
+    pthread_mutex_lock( &streamPtr->queueMutex );
+    streamPtr->cancelFlag = true;
+    pthread_cond_broadcast( &streamPtr->notFull );
+    pthread_mutex_unlock( &streamPtr->queueMutex );
+
+    // wait for loader to end
+       // function: pthread_join
+    pthread_join( streamPtr->loaderThread, NULL );
+
+    // loop across unconsumed blocks, release them
+       // function: clearMetaDataList
+    while( streamPtr->queueCount > 0 )
+       {
+        clearMetaDataList( streamPtr->blockQueue[ streamPtr->queueHead ] );
+
+        streamPtr->queueHead 
+                         = ( streamPtr->queueHead + 1 ) % STREAM_QUEUE_CAPACITY;
+        streamPtr->queueCount--;
+       }
+
+    // release synchronization and file buffer
+       // function: pthread_mutex_destroy, pthread_cond_destroy,
+       //           closeMetaDataBuffer
+    pthread_mutex_destroy( &streamPtr->queueMutex );
+    pthread_cond_destroy( &streamPtr->notEmpty );
+    pthread_cond_destroy( &streamPtr->notFull );
+    closeMetaDataBuffer( &streamPtr->mdBuffer );
+
+    // set end state message from loader
+       // function: copyString
+    copyString( endStateMsg, streamPtr->endStateMsg );
+
+    // return load result
+    return streamPtr->successFlag;
+   }
+
+/*
+Name: getArgCode
+Process: interns a first string argument of an op command by table lookup,
+         covers all devices and actions
+Function Input/Parameters: argument view (MetaDataView)
+Function Output/Parameters: none
+Function Output/Returned: argument code, BAD_ARG_CODE if not a valid
+                          first argument (OpArgCodes)
+Device Input/device: none
+Device Output/device: none
+Dependencies: compareViewString
+*/
+OpArgCodes getArgCode( MetaDataView argView )
+   {
+    // initialize function/variables
+    int code = ACCESS_ARG_CODE;
+
+    // loop across argument table until match found
+       // function: compareViewString
+    while( code < BAD_ARG_CODE 
+                  && compareViewString( argView, STR_ARG_STRINGS[ code ] ) 
+                                                                   != STR_EQ )
+       {
+        code++;
+       }
+
+    // return found code, or bad code at end of table
+    return (OpArgCodes)code;
+   }
+
 /* 
 Name: getCommand 
 Process: pareses three letter command part of op code string 
-Function Input/Parameters: input op code string (const char *),
+Function Input/Parameters: input op code view (MetaDataView),
                            starting index (int) 
-Function Output/Parameters: paresed command (char *)
+Function Output/Parameters: paresed command view (MetaDataView *)
 Function Output/Returned: updated starting index for use 
                           by calling function (int)
 Device Input/device: none 
 Device Output/device: none 
 Dependencies: none
 */
-int getCommand( char *cmd, const char *inputStr, int index )
+int getCommand( MetaDataView *cmd, MetaDataView inputView, int index )
    {
     // initialize variable
     int lengthOfCommand = 3; 
 
-    // loop across command length
-    while( index < lengthOfCommand ) 
-       {
-        // assign character from input string to buffer string
-        cmd[ index ] = inputStr[ index ];
-
-        // increment index
-        index++; 
+    // set command view to start of op command
+    cmd->str = &inputView.str[ index ];
+    cmd->length = 0;
 
-        // set next character to null character
-        cmd[ index ] = NULL_CHAR; 
+    // loop across command length, within the view
+    while( index < lengthOfCommand && index < inputView.length ) 
+       {
+        // increment index and command length
+        index++; cmd->length++;
        }
      // return current index
      return index;
    }
 
+/*
+Name: getCommandCode
+Process: interns a three-letter op command by table lookup
+Function Input/Parameters: command view (MetaDataView)
+Function Output/Parameters: none
+Function Output/Returned: command code, BAD_CMD_CODE if not a valid
+                          command (OpCommandCodes)
+Device Input/device: none
+Device Output/device: none
+Dependencies: compareViewString
+*/
+OpCommandCodes getCommandCode( MetaDataView cmdView )
+   {
+    // initialize function/variables
+    int code = SYS_CMD_CODE;
+
+    // loop across command table until match found
+       // function: compareViewString
+    while( code < BAD_CMD_CODE 
+                  && compareViewString( cmdView, COMMAND_STRINGS[ code ] ) 
+                                                                   != STR_EQ )
+       {
+        code++;
+       }
+
+    // return found code, or bad code at end of table
+    return (OpCommandCodes)code;
+   }
+
+/*
+Name: getInOutCode
+Process: interns a device in/out argument by table lookup
+Function Input/Parameters: in/out argument view (MetaDataView)
+Function Output/Parameters: none
+Function Output/Returned: in/out code, BAD_IO_CODE if not "in" 
+                          or "out" (OpInOutCodes)
+Device Input/device: none
+Device Output/device: none
+Dependencies: compareViewString
+*/
+OpInOutCodes getInOutCode( MetaDataView ioView )
+   {
+    // check for in argument
+       // function: compareViewString
+    if( compareViewString( ioView, IN_OUT_STRINGS[ IN_IO_CODE ] ) == STR_EQ )
+       {
+        return IN_IO_CODE;
+       }
+
+    // check for out argument
+       // function: compareViewString
+    if( compareViewString( ioView, IN_OUT_STRINGS[ OUT_IO_CODE ] ) == STR_EQ )
+       {
+        return OUT_IO_CODE;
+       }
+
+    // return bad argument code
+    return BAD_IO_CODE;
+   }
+
 /*
 Name: getMetaData
 Process: main driver function to upload, parse, and store list
-         of op code commands in a linked list
+         of op code commands in a contiguous op code table,
+         op commands are parsed in place over the mapped file,
+         table entries are linked for list traversal
 Function Input/Parameters: file name (const char *)
 Function Output/Parameters: pointer
                             to op code linked list head pointer (OpCodeType **),
@@ -201,25 +572,23 @@ Function Output/Parameters: pointer
 Function Output/Returned: Boolean result of operation (bool)
 Device Input/file: op code list uploaded
 Device Output/device: none
-Dependencies: copyString, fopen, getStringToDelimiter, compareString, fclose,
-              malloc, getOpCommand, updateStartCount, updateEndCount, 
-              clearMetaDataList, free, addNode
+Dependencies: copyString, openMetaDataBuffer, getViewToDelimiter,
+              compareViewString, closeMetaDataBuffer, getOpCommand,
+              updateStartCount, updateEndCount, clearMetaDataList, addOpCode,
+              linkOpCodeTable
 */
 bool getMetaData( const char *fileName, 
                                 OpCodeType **opCodeDataHead, char *endStateMsg )
   {
     // initialize function/variables
 
-       // initialize read only constant
-       const char READ_ONLY_FLAG[] = "r"; 
-
        // initialize variables
        int accessResult, startCount = 0, endCount = 0;
-       char dataBuffer[ MAX_STR_LEN ];
+       MetaDataView dataView;
        bool returnState = true;
-       OpCodeType *newNodePtr; 
-       OpCodeType *localHeadPtr = NULL;
-       FILE *fileAccessPtr;
+       OpCodeType newNode; 
+       OpCodeTable opTable = { NULL, 0, 0 };
+       MetaDataBuffer mdBuffer;
 
     // initialize op code data pointer in case of return error
     *opCodeDataHead = NULL; 
@@ -228,12 +597,9 @@ bool getMetaData( const char *fileName,
        // function: copyString
     copyString( endStateMsg, "Metadata file upload successful" ); 
 
-    // open file for reading 
-       // function: fopen
-    fileAccessPtr = fopen( fileName, READ_ONLY_FLAG ); 
-
-    // check for file open failure
-    if( fileAccessPtr == NULL )
+    // map or read file for parsing
+       // function: openMetaDataBuffer
+    if( !openMetaDataBuffer( fileName, &mdBuffer ) )
        { 
         // set end state messagee 
            // function: copyString
@@ -244,14 +610,14 @@ bool getMetaData( const char *fileName,
        }
 
     // check first line for correct leader 
-       // function: getStringToDelimiter, compareString
-    if( !getStringToDelimiter( fileAccessPtr, COLON, dataBuffer ) 
-            || compareString( dataBuffer, 
+       // function: getViewToDelimiter, compareViewString
+    if( !getViewToDelimiter( &mdBuffer, COLON, &dataView ) 
+            || compareViewString( dataView, 
                                     "Start Program Meta-Data Code" ) != STR_EQ )
        {
-        // close file 
-           // function: fclose
-        fclose( fileAccessPtr ); 
+        // release file buffer 
+           // function: closeMetaDataBuffer
+        closeMetaDataBuffer( &mdBuffer ); 
         
         // set end state message 
            // function: copyString
@@ -261,33 +627,21 @@ bool getMetaData( const char *fileName,
         return false;
        }
     
-    // allocate memory for the temporary data structure 
-       // function: malloc
-    newNodePtr = ( OpCodeType * ) malloc( sizeof( OpCodeType ) ); 
-    
     // get the first op command 
        // function: getOpCommand
-    accessResult = getOpCommand( fileAccessPtr, newNodePtr ); 
+    accessResult = getOpCommand( &mdBuffer, &newNode ); 
 
     // get start and end counts for later comparison 
        // function: updateStartCount, updateEndCount 
-    startCount = updateStartCount( startCount, newNodePtr->strArg1 );
-    endCount = updateEndCount( endCount, newNodePtr->strArg1 );
+    startCount = updateStartCount( startCount, newNode.strArg1 );
+    endCount = updateEndCount( endCount, newNode.strArg1 );
 
     // check for failure of first complete op command
     if( accessResult != COMPLETE_OPCMD_FOUND_MSG )
        { 
-        // close file 
-           // function: fclose
-        fclose( fileAccessPtr ); 
-
-        // clear data from the structure list 
-           // function: clearMetaDataList
-        *opCodeDataHead = clearMetaDataList( localHeadPtr ); 
-
-        // free temporary structure memory 
-           // function: free
-        free( newNodePtr );
+        // release file buffer 
+           // function: closeMetaDataBuffer
+        closeMetaDataBuffer( &mdBuffer ); 
 
         // set end state message 
            // function: copyString 
@@ -301,18 +655,23 @@ bool getMetaData( const char *fileName,
     //   (while complete op commands are found)
     while( accessResult == COMPLETE_OPCMD_FOUND_MSG )
        {
-        // add the new op command to the linked list 
-           // function: addNode
-        localHeadPtr = addNode( localHeadPtr, newNodePtr ); 
+        // add the new op command to the table, check for allocation failure
+           // function: addOpCode
+        if( !addOpCode( &opTable, &newNode ) )
+           {
+            // set access result to error, end loop
+            accessResult = OPCMD_ACCESS_ERR;
+            break;
+           }
 
         // get a new op command 
            // function: getOpCommand
-        accessResult = getOpCommand( fileAccessPtr, newNodePtr );
+        accessResult = getOpCommand( &mdBuffer, &newNode );
         
         // update start and end counts for later comparison 
            // function: updateStartCount, updateEndCount
-        startCount = updateStartCount( startCount, newNodePtr->strArg1 );
-        endCount = updateEndCount( endCount, newNodePtr->strArg1 );
+        startCount = updateStartCount( startCount, newNode.strArg1 );
+        endCount = updateEndCount( endCount, newNode.strArg1 );
        }
 
     // after loop compeltion, check for last op command found
@@ -321,17 +680,16 @@ bool getMetaData( const char *fileName,
         // check for start and end op code counts equal
         if( startCount == endCount )
            {
-            // add the last  node to the linked list
-               // function: addNode
-            localHeadPtr = addNode( localHeadPtr, newNodePtr );
-
-            // set access result to no error for later operation 
-            accessResult = NO_ACCESS_ERR;
+            // add the last node to the table, set access result
+            // to no error for later operation
+               // function: addOpCode
+            accessResult = addOpCode( &opTable, &newNode ) 
+                                           ? NO_ACCESS_ERR : OPCMD_ACCESS_ERR;
 
             // check last line for incorrect end descriptor 
-               // function: getStringToDelimiter, compareString 
-            if( !getStringToDelimiter( fileAccessPtr, PERIOD, dataBuffer )
-              || compareString( dataBuffer, "End Program Meta-Data Code" )
+               // function: getViewToDelimiter, compareViewString 
+            if( !getViewToDelimiter( &mdBuffer, PERIOD, &dataView )
+              || compareViewString( dataView, "End Program Meta-Data Code" )
                                                                    != STR_EQ )
                {
                 // set access result to corrupted descriptor error
@@ -346,17 +704,13 @@ bool getMetaData( const char *fileName,
         // otherwise, assume start/end counts not equal 
         else
            {
-            // close file 
-               // function: fclose
-            fclose( fileAccessPtr );
+            // release file buffer 
+               // function: closeMetaDataBuffer
+            closeMetaDataBuffer( &mdBuffer );
            
-            // clear data from the structure list 
+            // clear data from the op code table 
                // function: clearMetaDataList 
-            *opCodeDataHead = clearMetaDataList( localHeadPtr );
-
-            // free temporary structure memory 
-               // function: free 
-            free( newNodePtr );
+            *opCodeDataHead = clearMetaDataList( opTable.ops );
 
             // set access result to error 
             accessResult = UNBALANCED_START_END_ERR;
@@ -385,143 +739,437 @@ bool getMetaData( const char *fileName,
     // check for any errors found (not no error)
     if( accessResult != NO_ACCESS_ERR )
        {
-        // clear the op command list 
+        // clear the op code table 
            // function: clearMetaDataList
-        localHeadPtr = clearMetaDataList( localHeadPtr );
+        opTable.ops = clearMetaDataList( opTable.ops );
+        opTable.count = 0;
        }
 
-    // close access file
-       // function: fclose 
-    fclose( fileAccessPtr );
-
-    // release temporary structure memory
-       // function: free
-    free( newNodePtr ); 
+    // release file buffer
+       // function: closeMetaDataBuffer 
+    closeMetaDataBuffer( &mdBuffer );
     
-    // assign temporary local head pointer to parameter return pointer 
-    *opCodeDataHead = localHeadPtr;
+    // link table entries, assign head to parameter return pointer 
+       // function: linkOpCodeTable
+    *opCodeDataHead = linkOpCodeTable( &opTable );
 
     // return access result
     return returnState;
   }
 
-/* 
-Name: getOpCommand 
-Process: acquires one op command line from a previously opened file,
-         parses it, and sets various struct members according
-         to the three letter command
-Function Input/Parameters: pointer to open file handle (FILE *)
-Function Output/Parameters: pointer to one op code struct (OpCodeType *)
-Function Output/Returned: code result of operation (OpCodeMessages)
-Device Input/device: op code line uploaded
+/*
+Name: getMetaDataParallel
+Process: parallel upload driver; checks the leader line, splits the
+         remaining op commands into one chunk per thread, each ending
+         just after an op delimiter (semicolon or line end), bounds each
+         chunk's ops by its delimiters and sizes one table for all of 
+         them, parses the chunks concurrently, each into its own slice,
+         a chunk whose thread fails to start is parsed inline, then walks
+         the chunk results in order: start and end counts are summed as 
+         a running prefix, each slice is moved down to follow the ops 
+         before it, and the walk stops at the chunk holding the last op 
+         command or the first error; the end descriptor is then checked 
+         after the last op command; small files or one thread use 
+         getMetaData
+Function Input/Parameters: file name (const char *),
+                           number of threads, zero for all online cores (int)
+Function Output/Parameters: pointer
+                            to op code list head pointer (OpCodeType **),
+                            result message of function state
+                            after completion (char *)
+Function Output/Returned: Boolean result of operation (bool)
+Device Input/file: op code list uploaded
 Device Output/device: none
-Dependencies: getStringToDelimiter, getCommand, copyString, verifyValidCommand,
-              compareString, getStringArg, verifyFirstStringArg, getNumberArg
+Dependencies: sysconf, getMetaData, copyString, openMetaDataBuffer,
+              getViewToDelimiter, compareViewString, closeMetaDataBuffer,
+              malloc, free, pthread_create, parseMetaDataChunk, 
+              pthread_join, clearMetaDataList, linkOpCodeTable
 */
-OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
-   { 
+bool getMetaDataParallel( const char *fileName, OpCodeType **opCodeDataHead,
+                                            char *endStateMsg, int numThreads )
+   {
     // initialize function/variables
-
-       // initialize local constants 
-       const int MAX_CMD_LENGTH = 5;
-       const int MAX_ARG_STR_LENGTH = 15;
-
-       // initialize other variables
-       int numBuffer = 0;
-       char strBuffer[ STD_STR_LEN ];
-       char cmdBuffer[ MAX_CMD_LENGTH ];
-       char argStrBuffer[ MAX_ARG_STR_LENGTH ];
-       int runningStringIndex = 0;
-       bool arg2FailureFlag = false;
-       bool arg3FailureFlag = false; 
-
-    // get whole op command as string, check for successful access 
-       // function: getStringToDelimiter
-    if( getStringToDelimiter( filePtr, SEMICOLON, strBuffer ) )
-       { 
-        // get three-letter command 
-           // function: getCommand
-        runningStringIndex = getCommand( cmdBuffer, 
-                                               strBuffer, runningStringIndex ); 
-        // assign op command to node 
-           // function: copyString
-        copyString( inData->command, cmdBuffer );
+    MetaDataBuffer mdBuffer;
+    MetaDataView dataView;
+    MetaDataChunk *chunks;
+    OpCodeTable opTable = { NULL, 0, 0 };
+    size_t opStartPos, chunkPos, chunkEnd, dataPos, lastOpEndPos = 0;
+    int numChunks = 0, chunkIndex, opIndex, totalOps = 0;
+    int opBound = 0, sliceStart = 0;
+    int startCount = 0, endCount = 0;
+    int accessResult = OPCMD_ACCESS_ERR;
+    bool returnState = true;
+
+    // set thread count to online cores as needed, within limits
+       // function: sysconf
+    if( numThreads <= 0 )
+       {
+        numThreads = (int)sysconf( _SC_NPROCESSORS_ONLN );
        }
 
-    // otherwise, assume unsuccessful access 
-    else
+    if( numThreads > MAX_PARSE_THREADS )
        {
-        // set pointer to data structure to null
-        inData = NULL;
-
-        // return op command access failure
-        return OPCMD_ACCESS_ERR;
+        numThreads = MAX_PARSE_THREADS;
        }
 
-    // verify op command 
-    if( !verifyValidCommand( cmdBuffer ) )
+    // check for single thread, use sequential upload
+       // function: getMetaData
+    if( numThreads <= 1 )
        {
-        // return op command error
-        return CORRUPT_OPCMD_ERR;
+        return getMetaData( fileName, opCodeDataHead, endStateMsg );
        }
 
-    // set all struct values that may not be initialized to defualts 
-    inData->pid = 0;
-    inData->inOutArg[ 0 ] = NULL_CHAR;
-    inData->intArg2 = 0;
-    inData->intArg3 = 0;
-    inData->opEndTime = 0.0;
-    inData->nextNode = NULL;
-
-    // check for device command 
-    if( compareString( cmdBuffer, "dev" ) == STR_EQ )
-       {
-        // get in/out argument
-        runningStringIndex = getStringArg( argStrBuffer, 
-                                              strBuffer, runningStringIndex ); 
+    // initialize op code data pointer in case of return error
+    *opCodeDataHead = NULL; 
 
-        // set device in/out argument
-        copyString( inData->inOutArg, argStrBuffer ); 
+    // intialize end state message 
+       // function: copyString
+    copyString( endStateMsg, "Metadata file upload successful" ); 
 
-        // check correct argument
-        if( compareString( argStrBuffer, "in" ) != STR_EQ 
-            && compareString( argStrBuffer, "out" ) != STR_EQ )
-           { 
-            // return argument error
-            return CORRUPT_OPCMD_ARG_ERR;
-           }
+    // map or read file for parsing
+       // function: openMetaDataBuffer
+    if( !openMetaDataBuffer( fileName, &mdBuffer ) )
+       { 
+        copyString( endStateMsg, "Metadata file access error" );
+        return false;
        }
 
-    // get first string arg
-    runningStringIndex = getStringArg( argStrBuffer, 
-                                              strBuffer, runningStringIndex );
-
-    // set device in/out argument
-    copyString( inData->strArg1, argStrBuffer );
-
-    // check for legitimate first string arg
-    if( !verifyFirstStringArg( argStrBuffer ) )
+    // check for small file, use sequential upload
+       // function: closeMetaDataBuffer, getMetaData
+    if( mdBuffer.length < PARALLEL_PARSE_MIN_SIZE )
        {
-        // return argument error
-        return CORRUPT_OPCMD_ARG_ERR;
+        closeMetaDataBuffer( &mdBuffer );
+        return getMetaData( fileName, opCodeDataHead, endStateMsg );
        }
 
-    // check for last op command found
-    if( compareString( inData->command, "sys" ) == STR_EQ 
-                          && compareString( inData->strArg1, "end" ) == STR_EQ )
+    // check first line for correct leader 
+       // function: getViewToDelimiter, compareViewString
+    if( !getViewToDelimiter( &mdBuffer, COLON, &dataView ) 
+            || compareViewString( dataView, 
+                                    "Start Program Meta-Data Code" ) != STR_EQ )
        {
-        // return last op command message
-        return LAST_OPCMD_FOUND_MSG;
+        closeMetaDataBuffer( &mdBuffer ); 
+        copyString( endStateMsg, "Corrupt metadata leader line error" );
+        return false;
        }
 
-    // check for app start seconds argument 
-    if( compareString( inData->command, "app" ) == STR_EQ
-                        && compareString( inData->strArg1, "start" ) == STR_EQ )
+    // allocate chunk records, check for failure
+       // function: malloc, closeMetaDataBuffer, copyString
+    chunks = (MetaDataChunk *)malloc( numThreads * sizeof( MetaDataChunk ) );
+
+    if( chunks == NULL )
        {
-        // get number argument 
-           // function: getNumberArg 
-        runningStringIndex = getNumberArg( &numBuffer, 
-                                               strBuffer, runningStringIndex );
+        closeMetaDataBuffer( &mdBuffer );
+        copyString( endStateMsg, "Metadata memory allocation error" );
+        return false;
+       }
+
+    opStartPos = mdBuffer.position;
+    chunkPos = opStartPos;
+
+    // loop to split op commands into chunks
+    while( chunkPos < mdBuffer.length && numChunks < numThreads )
+       {
+        // set even share end, last chunk ends at end of data
+        chunkEnd = opStartPos + ( mdBuffer.length - opStartPos ) 
+                                       / numThreads * ( numChunks + 1 );
+
+        if( numChunks == numThreads - 1 || chunkEnd > mdBuffer.length )
+           {
+            chunkEnd = mdBuffer.length;
+           }
+
+        // move end forward past next op delimiter
+        while( chunkEnd < mdBuffer.length 
+                         && mdBuffer.data[ chunkEnd ] != SEMICOLON
+                                   && mdBuffer.data[ chunkEnd ] >= SPACE )
+           {
+            chunkEnd++;
+           }
+
+        if( chunkEnd < mdBuffer.length )
+           {
+            chunkEnd++;
+           }
+
+        // check for chunk not empty, set chunk section and its op bound:
+        // an op view ends at a delimiter or at the string length limit,
+        // so one per delimiter, one per limit length, and one unterminated
+        if( chunkEnd > chunkPos )
+           {
+            chunks[ numChunks ].chunkBuffer.data = mdBuffer.data;
+            chunks[ numChunks ].chunkBuffer.position = chunkPos;
+            chunks[ numChunks ].chunkBuffer.length = chunkEnd;
+            chunks[ numChunks ].chunkBuffer.mappedFlag = false;
+            chunks[ numChunks ].opTable.capacity = 1
+                      + (int)( ( chunkEnd - chunkPos ) / ( MAX_STR_LEN - 1 ) );
+
+            for( dataPos = chunkPos; dataPos < chunkEnd; dataPos++ )
+               {
+                if( mdBuffer.data[ dataPos ] == SEMICOLON 
+                                         || mdBuffer.data[ dataPos ] < SPACE )
+                   {
+                    chunks[ numChunks ].opTable.capacity++;
+                   }
+               }
+
+            opBound += chunks[ numChunks ].opTable.capacity;
+            numChunks++;
+           }
+
+        chunkPos = chunkEnd;
+       }
+
+    // allocate whole table once, check for failure
+       // function: malloc, free, closeMetaDataBuffer, copyString
+    opTable.ops = (OpCodeType *)malloc( opBound * sizeof( OpCodeType ) );
+    opTable.capacity = opBound;
+
+    if( opTable.ops == NULL )
+       {
+        free( chunks );
+        closeMetaDataBuffer( &mdBuffer );
+        copyString( endStateMsg, "Metadata memory allocation error" );
+        return false;
+       }
+
+    // give each chunk its slice of the table
+    for( chunkIndex = 0; chunkIndex < numChunks; chunkIndex++ )
+       {
+        chunks[ chunkIndex ].opTable.ops = opTable.ops + sliceStart;
+        sliceStart += chunks[ chunkIndex ].opTable.capacity;
+       }
+
+    // start one parser thread per chunk, parse here if one does not start
+       // function: pthread_create, parseMetaDataChunk
+    for( chunkIndex = 0; chunkIndex < numChunks; chunkIndex++ )
+       {
+        chunks[ chunkIndex ].startedFlag = pthread_create( 
+                        &chunks[ chunkIndex ].thread, NULL, 
+                           parseMetaDataChunk, &chunks[ chunkIndex ] ) == 0;
+
+        if( !chunks[ chunkIndex ].startedFlag )
+           {
+            parseMetaDataChunk( &chunks[ chunkIndex ] );
+           }
+       }
+
+    // wait for parser threads that started
+       // function: pthread_join
+    for( chunkIndex = 0; chunkIndex < numChunks; chunkIndex++ )
+       {
+        if( chunks[ chunkIndex ].startedFlag )
+           {
+            pthread_join( chunks[ chunkIndex ].thread, NULL );
+           }
+       }
+
+    // loop across chunks in order, sum counts and ops up to the chunk
+    // holding the last op command or the first error; move each slice
+    // down to follow the ops before it
+    for( chunkIndex = 0; chunkIndex < numChunks 
+                && accessResult == OPCMD_ACCESS_ERR; chunkIndex++ )
+       {
+        // update running start/end counts and op total
+        startCount += chunks[ chunkIndex ].startCount;
+        endCount += chunks[ chunkIndex ].endCount;
+        totalOps += chunks[ chunkIndex ].opTable.count;
+
+        for( opIndex = 0; 
+                 opIndex < chunks[ chunkIndex ].opTable.count; opIndex++ )
+           {
+            opTable.ops[ opTable.count ] 
+                                   = chunks[ chunkIndex ].opTable.ops[ opIndex ];
+            opTable.count++;
+           }
+
+        // set chunk result, chunk end is reported as access error
+        accessResult = chunks[ chunkIndex ].accessResult;
+        lastOpEndPos = chunks[ chunkIndex ].lastOpEndPos;
+       }
+
+    // release chunk records
+       // function: free
+    free( chunks );
+
+    // check for failure of first complete op command
+    if( totalOps == 0 
+               || ( totalOps == 1 && accessResult == LAST_OPCMD_FOUND_MSG ) )
+       {
+        copyString( endStateMsg, "Metadata incomplete first op command found" );
+        accessResult = CORRUPT_OPCMD_ERR;
+        returnState = false;
+       }
+
+    // otherwise, check for last op command found
+    else if( accessResult == LAST_OPCMD_FOUND_MSG )
+       {
+        // check for start and end op code counts equal
+        if( startCount == endCount )
+           {
+            // set access result to no error for later operation 
+            accessResult = NO_ACCESS_ERR;
+
+            // check last line after last op for incorrect end descriptor 
+               // function: getViewToDelimiter, compareViewString 
+            mdBuffer.position = lastOpEndPos;
+
+            if( !getViewToDelimiter( &mdBuffer, PERIOD, &dataView )
+              || compareViewString( dataView, "End Program Meta-Data Code" )
+                                                                   != STR_EQ )
+               {
+                accessResult = MD_CORRUPT_DESCRIPTOR_ERR;
+                copyString( endStateMsg, "Metadata corrupted descriptor error" );
+               }
+           }
+
+        // otherwise, assume start/end counts not equal 
+        else
+           {
+            copyString( endStateMsg, 
+                              "Unbalanced start and end arguments in metadata" );
+            returnState = false;
+           }
+       }
+
+    // otherwise, assume didn't find end 
+    else
+       {
+        copyString( endStateMsg, "Corrupted metadata op code" ); 
+        returnState = false;
+       }
+
+    // check for any errors found (not no error)
+       // function: clearMetaDataList
+    if( accessResult != NO_ACCESS_ERR )
+       {
+        opTable.ops = clearMetaDataList( opTable.ops );
+        opTable.count = 0;
+       }
+
+    // release file buffer
+       // function: closeMetaDataBuffer 
+    closeMetaDataBuffer( &mdBuffer );
+    
+    // link table entries, assign head to parameter return pointer 
+       // function: linkOpCodeTable
+    *opCodeDataHead = linkOpCodeTable( &opTable );
+
+    // return access result
+    return returnState;
+   }
+
+/* 
+Name: getOpCommand 
+Process: acquires one op command from a previously opened metadata buffer,
+         parses it in place, and sets various struct members according
+         to the three letter command
+Function Input/Parameters: pointer to open metadata buffer (MetaDataBuffer *)
+Function Output/Parameters: pointer to one op code struct (OpCodeType *)
+Function Output/Returned: code result of operation (OpCodeMessages)
+Device Input/device: op code line uploaded
+Device Output/device: none
+Dependencies: getViewToDelimiter, getCommand, getCommandCode, getStringArg,
+              getInOutCode, getArgCode, getNumberArg
+*/
+OpCodeMessages getOpCommand( MetaDataBuffer *mdBuffer, OpCodeType *inData )
+   { 
+    // initialize function/variables
+    int numBuffer = 0;
+    MetaDataView opView, cmdView, argView;
+    int runningStringIndex = 0;
+    bool arg2FailureFlag = false;
+    bool arg3FailureFlag = false; 
+
+    // get whole op command as view, check for successful access 
+       // function: getViewToDelimiter
+    if( getViewToDelimiter( mdBuffer, SEMICOLON, &opView ) )
+       { 
+        // get three-letter command 
+           // function: getCommand
+        runningStringIndex = getCommand( &cmdView, 
+                                                 opView, runningStringIndex ); 
+        // intern op command to node 
+           // function: getCommandCode
+        inData->command = (unsigned char)getCommandCode( cmdView );
+       }
+
+    // otherwise, assume unsuccessful access 
+    else
+       {
+        // set pointer to data structure to null
+        inData = NULL;
+
+        // return op command access failure
+        return OPCMD_ACCESS_ERR;
+       }
+
+    // verify op command 
+    if( inData->command == BAD_CMD_CODE )
+       {
+        // return op command error
+        return CORRUPT_OPCMD_ERR;
+       }
+
+    // set all struct values that may not be initialized to defualts 
+    inData->pid = 0;
+    inData->inOutArg = NO_IO_CODE;
+    inData->intArg2 = 0;
+    inData->intArg3 = 0;
+    inData->opTime = 0;
+    inData->opKind = UNDECODED_OP;
+    inData->lastOpFlag = false;
+
+    // check for device command 
+    if( inData->command == DEV_CMD_CODE )
+       {
+        // get in/out argument
+           // function: getStringArg
+        runningStringIndex = getStringArg( &argView, 
+                                                 opView, runningStringIndex ); 
+
+        // intern device in/out argument
+           // function: getInOutCode
+        inData->inOutArg = (unsigned char)getInOutCode( argView ); 
+
+        // check correct argument
+        if( inData->inOutArg == BAD_IO_CODE )
+           { 
+            // return argument error
+            return CORRUPT_OPCMD_ARG_ERR;
+           }
+       }
+
+    // get first string arg
+       // function: getStringArg
+    runningStringIndex = getStringArg( &argView, 
+                                                 opView, runningStringIndex );
+
+    // intern first string argument
+       // function: getArgCode
+    inData->strArg1 = (unsigned char)getArgCode( argView );
+
+    // check for legitimate first string arg
+    if( inData->strArg1 == BAD_ARG_CODE )
+       {
+        // return argument error
+        return CORRUPT_OPCMD_ARG_ERR;
+       }
+
+    // check for last op command found
+    if( inData->command == SYS_CMD_CODE && inData->strArg1 == END_ARG_CODE )
+       {
+        // return last op command message
+        return LAST_OPCMD_FOUND_MSG;
+       }
+
+    // check for app start seconds argument 
+    if( inData->command == APP_CMD_CODE && inData->strArg1 == START_ARG_CODE )
+       {
+        // get number argument 
+           // function: getNumberArg 
+        runningStringIndex = getNumberArg( &numBuffer, 
+                                                 opView, runningStringIndex );
 
         // check for failed number access 
         if( numBuffer <= BAD_ARG_VAL )
@@ -535,12 +1183,12 @@ OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
        }
 
     // check for cpu cycle time
-    else if( compareString( inData->command, "cpu" ) == STR_EQ )
+    else if( inData->command == CPU_CMD_CODE )
        {
         // get number argument 
            // function: getNumberArg
         runningStringIndex = getNumberArg( &numBuffer, 
-                                               strBuffer, runningStringIndex );
+                                                 opView, runningStringIndex );
         // check for failed number access 
         if( numBuffer <= BAD_ARG_VAL )
            {
@@ -553,12 +1201,12 @@ OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
        } 
 
      // check for device cycle time
-     else if( compareString( inData->command, "dev" ) == STR_EQ ) 
+     else if( inData->command == DEV_CMD_CODE ) 
         {
          // get number argument 
             // function: getNumberArg
          runningStringIndex = getNumberArg( &numBuffer, 
-                                               strBuffer, runningStringIndex );
+                                                 opView, runningStringIndex );
          // check for failed number access 
          if( numBuffer <= BAD_ARG_VAL )
             {
@@ -571,12 +1219,12 @@ OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
         }
 
      // check for memory base and offset
-     else if( compareString( inData->command, "mem" ) == STR_EQ )
+     else if( inData->command == MEM_CMD_CODE )
         { 
          // get number argument for base 
             // function: getNumberArg 
          runningStringIndex = getNumberArg( &numBuffer, 
-                                               strBuffer, runningStringIndex );
+                                                 opView, runningStringIndex );
          // check for failed number access 
          if( numBuffer <= BAD_ARG_VAL )
             {
@@ -590,7 +1238,7 @@ OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
          // get number argument for offset 
             // function: getNumberArg 
          runningStringIndex = getNumberArg( &numBuffer, 
-                                               strBuffer, runningStringIndex );
+                                                 opView, runningStringIndex );
                             
          // check for failed number access
          if( numBuffer <= BAD_ARG_VAL )
@@ -618,35 +1266,37 @@ OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData )
 Name: getNumberArg
 Process: starts at given index, captures and assembles integer argument, 
          and returns as parameter 
-Function Input/Parameters: input string (const char *), starting index (int)
+Function Input/Parameters: input op code view (MetaDataView), starting index (int)
 Function Output/Parameters: pointer to captured integer value
 Function Output/Returned: updated index for next function start
 Device Input/device: none
 Device Output/device: none
 Dependencies: isDigit
 */
-int getNumberArg( int *number, const char *inputStr, int index )
+int getNumberArg( int *number, MetaDataView inputView, int index )
    {
     // initialize function/variables
     bool foundDigit = false;
     *number = 0;
     int multiplier = 1; 
 
-    // loop to skip white space
-    while( inputStr[ index ] <= SPACE || inputStr[ index ] == COMMA )
+    // loop to skip white space, within the view
+    while( index < inputView.length 
+                      && ( inputView.str[ index ] <= SPACE 
+                                           || inputView.str[ index ] == COMMA ) )
        {
         index++;
        } 
 
-    // loop across string length 
-    while( isDigit( inputStr[ index ] ) == true 
-                                          && inputStr[ index ] != NULL_CHAR )
+    // loop across view length 
+    while( index < inputView.length 
+                                 && isDigit( inputView.str[ index ] ) == true )
        {
         // set digit found flag
         foundDigit = true;
 
         // assign digit to output
-        (*number) = (*number) * multiplier + inputStr[ index ] - '0';
+        (*number) = (*number) * multiplier + inputView.str[ index ] - '0';
 
         // increment index and multiplier
         index++; multiplier = 10;
@@ -665,39 +1315,243 @@ int getNumberArg( int *number, const char *inputStr, int index )
 Name: getStringArg
 Process: starts at given index, captures and assembles string argument, 
          and returns as parameter 
-Function Input/Parameters: input string (const char *), starting index (int)
-Function Output/Parameters: pointer to captured string argument (char *) 
+Function Input/Parameters: input op code view (MetaDataView), starting index (int)
+Function Output/Parameters: pointer to captured argument view (MetaDataView *) 
 Function Output/Returned: updated index for next function start
 Device Input/device: none
 Device Output/device: none
 Dependencies: none
 */
-int getStringArg( char *strArg, const char *inputStr, int index )
+int getStringArg( MetaDataView *strArg, MetaDataView inputView, int index )
+   {
+    // loop to skip white space, within the view
+    while( index < inputView.length 
+                      && ( inputView.str[ index ] <= SPACE 
+                                           || inputView.str[ index ] == COMMA ) )
+       {
+        index++;
+       }
+
+    // set argument view to start of argument
+    strArg->str = &inputView.str[ index ];
+    strArg->length = 0;
+
+    // loop across view length to next comma
+    while( index < inputView.length && inputView.str[ index ] != COMMA )
+       {
+        // increment index and argument length
+        index++; strArg->length++;
+       }
+
+    // return current index 
+    return index;
+   }
+
+/*
+Name: getStreamProcess
+Process: waits for the next completed process block from the stream loader
+Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+Function Output/Parameters: none
+Function Output/Returned: head of process op list, app start through app end,
+                          NULL when loading has ended and queue is empty
+                          (OpCodeType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_wait, pthread_cond_signal,
+              pthread_mutex_unlock
+*/
+OpCodeType *getStreamProcess( MetaDataStream *streamPtr )
    {
     // initialize function/variables
-    int localIndex = 0; 
+    OpCodeType *blockHead = NULL;
+
+    // lock queue
+       // function: pthread_mutex_lock
+    pthread_mutex_lock( &streamPtr->queueMutex );
 
-    // loop to skip white space
-    while( inputStr[ index ] <= SPACE || inputStr[ index ] == COMMA )
+    // wait for block or end of loading
+       // function: pthread_cond_wait
+    while( streamPtr->queueCount == 0 && !streamPtr->doneFlag )
        {
-        index++;
+        pthread_cond_wait( &streamPtr->notEmpty, &streamPtr->queueMutex );
        }
 
-    // loop across string length 
-    while( inputStr[ index ] != COMMA && inputStr[ index ] != NULL_CHAR )
+    // check for block available
+    if( streamPtr->queueCount > 0 )
        {
-        // assign character from input string to buffer string
-        strArg[ localIndex ] = inputStr[ index ]; 
+        // take block from queue head
+        blockHead = streamPtr->blockQueue[ streamPtr->queueHead ];
+        streamPtr->queueHead 
+                         = ( streamPtr->queueHead + 1 ) % STREAM_QUEUE_CAPACITY;
+        streamPtr->queueCount--;
+
+        // wake loader if waiting on full queue
+           // function: pthread_cond_signal
+        pthread_cond_signal( &streamPtr->notFull );
+       }
 
-        // increment index
-        index++; localIndex++; 
+    // unlock queue
+       // function: pthread_mutex_unlock
+    pthread_mutex_unlock( &streamPtr->queueMutex );
+
+    // return block, or NULL at end of loading
+    return blockHead;
+   }
 
-        // set next character to null character
-        strArg[ localIndex ] = NULL_CHAR;
+/*
+Name: getViewToDelimiter
+Process: captures a view of the metadata buffer up to a specified delimiter,
+         clears leading non printable and space characters,
+         stops at non printable characters, consumes the delimiter;
+         same rules as getStringToDelimiter without per character
+         stream access or copying
+Function Input/Parameters: pointer to open metadata buffer (MetaDataBuffer *),
+                           delimiter (char)
+Function Output/Parameters: captured view into the buffer (MetaDataView *)
+Function Output/Returned: Boolean result of operation, false at end of data
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+bool getViewToDelimiter( MetaDataBuffer *mdBuffer, 
+                                    char delimiter, MetaDataView *capturedView )
+   {
+    // initialize function/variables
+    const char *data = mdBuffer->data;
+    size_t position = mdBuffer->position;
+    size_t length = mdBuffer->length;
+    size_t startPos;
+
+    // loop to clear non printable or space
+    while( position < length && data[ position ] <= SPACE )
+       {
+        position++;
        }
 
-    // return current index 
-    return index;
+    // check for end of data found
+    if( position >= length )
+       {
+        // update buffer position, return failed operation
+        mdBuffer->position = position;
+        return false;
+       }
+
+    // set view start
+    startPos = position;
+
+    // loop to capture printable characters up to delimiter,
+    // with same length limit as string capture
+    while( position < length && data[ position ] >= SPACE 
+                && data[ position ] != delimiter
+                       && position - startPos < MAX_STR_LEN - 1 )
+       {
+        position++;
+       }
+
+    // set captured view
+    capturedView->str = &data[ startPos ];
+    capturedView->length = (int)( position - startPos );
+
+    // consume stop character unless length limit was reached
+    if( position < length && position - startPos < MAX_STR_LEN - 1 )
+       {
+        position++;
+       }
+
+    // update buffer position
+    mdBuffer->position = position;
+
+    // return successful operation
+    return true;
+   }
+
+/*
+Name: inOutCodeToString
+Process: converts an interned device in/out code to its display string
+Function Input/Parameters: in/out code (int)
+Function Output/Parameters: none
+Function Output/Returned: display string, empty if code invalid (const char *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+const char *inOutCodeToString( int code )
+   {
+    // check for code in table range
+    if( code >= NO_IO_CODE && code < BAD_IO_CODE )
+       {
+        // return table string
+        return IN_OUT_STRINGS[ code ];
+       }
+
+    // return empty string
+    return "";
+   }
+
+/*
+Name: indexProcess
+Process: summarizes one process; counts its ops from app start through
+         app end, sums cpu cycles and I/O cycles from the op cycle
+         arguments, and counts memory ops
+Function Input/Parameters: app start op code (OpCodeType *),
+                           table position of app start op (int)
+Function Output/Parameters: pointer to index entry (ProcessIndexType *)
+Function Output/Returned: op code after the process, NULL at list end
+                          (OpCodeType *)
+Device Input/file: none
+Device Output/device: none
+Dependencies: nextOpCode
+*/
+OpCodeType *indexProcess( OpCodeType *appStartPtr, int firstOp, 
+                                                 ProcessIndexType *procPtr )
+   {
+    // initialize function/variables
+    OpCodeType *opPtr = nextOpCode( appStartPtr );
+
+    // set index entry for app start op
+    procPtr->appStart = appStartPtr;
+    procPtr->firstOp = firstOp;
+    procPtr->opCount = 1;
+    procPtr->cpuCycles = 0;
+    procPtr->ioCycles = 0;
+    procPtr->memOpCount = 0;
+
+    // loop across process ops to next app op
+    while( opPtr != NULL && opPtr->command != APP_CMD_CODE )
+       {
+        // add op to process summary by command
+        switch( opPtr->command )
+           {
+            case CPU_CMD_CODE:
+
+               procPtr->cpuCycles = procPtr->cpuCycles + opPtr->intArg2;
+               break;
+
+            case DEV_CMD_CODE:
+
+               procPtr->ioCycles = procPtr->ioCycles + opPtr->intArg2;
+               break;
+
+            case MEM_CMD_CODE:
+
+               procPtr->memOpCount++;
+               break;
+           }
+
+        // update op count and pointer
+        procPtr->opCount++;
+        opPtr = nextOpCode( opPtr );
+       }
+
+    // check for app end op, include it in process
+    if( opPtr != NULL && opPtr->strArg1 == END_ARG_CODE )
+       {
+        procPtr->opCount++;
+        opPtr = nextOpCode( opPtr );
+       }
+
+    // return op after process
+    return opPtr;
    }
 
 /*
@@ -717,24 +1571,665 @@ bool isDigit( char testChar )
     return ( testChar >= '0' && testChar <= '9' );
    }
 
+/*
+Name: linkOpCodeTable
+Process: flags the last table entry, so list traversals through 
+         nextOpCode step across the table and end there
+Function Input/Parameters: pointer to op code table (OpCodeTable *)
+Function Output/Parameters: linked op code table (OpCodeTable *)
+Function Output/Returned: head of op code list, NULL if empty (OpCodeType *)
+Device Input/file: none
+Device Output/device: none
+Dependencies: none
+*/
+OpCodeType *linkOpCodeTable( OpCodeTable *table )
+   {
+    // initialize function/variables
+    int index;
+
+    // check for empty table
+    if( table->count == 0 )
+       {
+        // return empty list
+        return NULL;
+       }
+
+    // loop across all but last entry, each continues to next entry
+    for( index = 0; index < table->count - 1; index++ )
+       {
+        table->ops[ index ].lastOpFlag = false;
+       }
+
+    // set end of list
+    table->ops[ table->count - 1 ].lastOpFlag = true;
+
+    // return table head
+    return table->ops;
+   }
+
+/*
+Name: nextOpCode
+Process: steps to the following op of a linked op code table; list ops
+         are contiguous, so the next op is the next table entry unless
+         this op is flagged last
+Function Input/Parameters: op code in list (const OpCodeType *)
+Function Output/Parameters: none
+Function Output/Returned: next op code, NULL at list end (OpCodeType *)
+Device Input/file: none
+Device Output/device: none
+Dependencies: none
+*/
+OpCodeType *nextOpCode( const OpCodeType *opPtr )
+   {
+    // check for last op, return end of list
+    if( opPtr->lastOpFlag )
+       {
+        return NULL;
+       }
+
+    // return following table entry
+    return (OpCodeType *)( opPtr + 1 );
+   }
+
+/*
+Name: loadMetaDataStream
+Process: stream loader thread; checks the leader line, parses op commands
+         with getOpCommand, and queues each app start ... app end block
+         as soon as it is complete, as its own linked op code table;
+         ops outside process blocks are validated but not queued;
+         the load result uses the same messages as getMetaData
+Function Input/Parameters: pointer to metadata stream (void *)
+Function Output/Parameters: none
+Function Output/Returned: NULL (void *)
+Device Input/file: op code list uploaded
+Device Output/device: none
+Dependencies: getViewToDelimiter, compareViewString, getOpCommand, addOpCode,
+              linkOpCodeTable, pushStreamProcess, clearMetaDataList,
+              copyString, pthread_mutex_lock, pthread_cond_broadcast,
+              pthread_mutex_unlock
+*/
+void *loadMetaDataStream( void *arg )
+   {
+    // initialize function/variables
+    MetaDataStream *streamPtr = (MetaDataStream *)arg;
+    MetaDataView dataView;
+    OpCodeType newNode;
+    OpCodeTable blockTable = { NULL, 0, 0 };
+    int accessResult, opCount = 0;
+    bool inBlockFlag = false, runFlag = true, successFlag = false;
+    const char *resultMsg = "Metadata file upload successful";
+
+    // check first line for correct leader
+       // function: getViewToDelimiter, compareViewString
+    if( !getViewToDelimiter( &streamPtr->mdBuffer, COLON, &dataView ) 
+            || compareViewString( dataView, 
+                                    "Start Program Meta-Data Code" ) != STR_EQ )
+       {
+        // set leader line error, no op commands read
+        resultMsg = "Corrupt metadata leader line error";
+        accessResult = MD_CORRUPT_DESCRIPTOR_ERR;
+        runFlag = false;
+       }
+
+    // otherwise, get the first op command
+    else
+       {
+           // function: getOpCommand
+        accessResult = getOpCommand( &streamPtr->mdBuffer, &newNode );
+       }
+
+    // loop across all op commands while complete and not cancelled
+    while( runFlag && accessResult == COMPLETE_OPCMD_FOUND_MSG )
+       {
+        // update op count
+        opCount++;
+
+        // check for process start
+        if( newNode.command == APP_CMD_CODE 
+                                        && newNode.strArg1 == START_ARG_CODE )
+           {
+            // check for start inside a block
+            runFlag = !inBlockFlag;
+
+            // set new empty block, as needed
+            if( runFlag )
+               {
+                inBlockFlag = true;
+                blockTable.ops = NULL;
+                blockTable.count = 0;
+                blockTable.capacity = 0;
+               }
+           }
+
+        // add op to current block, check for allocation failure
+           // function: addOpCode
+        if( runFlag && inBlockFlag && !addOpCode( &blockTable, &newNode ) )
+           {
+            // set allocation error, end loop
+            resultMsg = "Metadata memory allocation error";
+            accessResult = OPCMD_ACCESS_ERR;
+            runFlag = false;
+           }
+
+        // check for process end
+        if( runFlag && newNode.command == APP_CMD_CODE 
+                                          && newNode.strArg1 == END_ARG_CODE )
+           {
+            // check for end outside a block
+            runFlag = inBlockFlag;
+
+            // queue completed block, check for cancelled stream
+               // function: linkOpCodeTable, pushStreamProcess
+            if( runFlag )
+               {
+                inBlockFlag = false;
+                runFlag = pushStreamProcess( streamPtr, 
+                                              linkOpCodeTable( &blockTable ) );
+                accessResult = runFlag ? accessResult : NO_ACCESS_ERR;
+               }
+           }
+
+        // check for unbalanced start or end found
+        if( !runFlag && accessResult == COMPLETE_OPCMD_FOUND_MSG )
+           {
+            resultMsg = "Unbalanced start and end arguments in metadata";
+            accessResult = UNBALANCED_START_END_ERR;
+           }
+
+        // get a new op command, as needed
+           // function: getOpCommand
+        if( runFlag )
+           {
+            accessResult = getOpCommand( &streamPtr->mdBuffer, &newNode );
+           }
+       }
+
+    // check for last op command found
+    if( runFlag && accessResult == LAST_OPCMD_FOUND_MSG )
+       {
+        // check for first op command incomplete or unfinished block
+        if( opCount == 0 )
+           {
+            resultMsg = "Metadata incomplete first op command found";
+           }
+
+        else if( inBlockFlag )
+           {
+            resultMsg = "Unbalanced start and end arguments in metadata";
+           }
+
+        // otherwise, check last line for incorrect end descriptor 
+           // function: getViewToDelimiter, compareViewString 
+        else if( !getViewToDelimiter( &streamPtr->mdBuffer, PERIOD, &dataView )
+              || compareViewString( dataView, "End Program Meta-Data Code" )
+                                                                   != STR_EQ )
+           {
+            resultMsg = "Metadata corrupted descriptor error";
+           }
+
+        // otherwise, assume successful load
+        else
+           {
+            successFlag = true;
+           }
+       }
+
+    // otherwise, check for op command failure
+    else if( runFlag )
+       {
+        resultMsg = opCount == 0 ? "Metadata incomplete first op command found"
+                                 : "Corrupted metadata op code";
+       }
+
+    // otherwise, check for cancelled by simulator
+    else if( accessResult == NO_ACCESS_ERR )
+       {
+        resultMsg = "Metadata upload cancelled";
+       }
+
+    // release unfinished block
+       // function: clearMetaDataList
+    if( inBlockFlag )
+       {
+        clearMetaDataList( blockTable.ops );
+       }
+
+    // set result, wake simulator if waiting for a block
+       // function: pthread_mutex_lock, copyString, pthread_cond_broadcast,
+       //           pthread_mutex_unlock
+    pthread_mutex_lock( &streamPtr->queueMutex );
+    streamPtr->successFlag = successFlag;
+    copyString( streamPtr->endStateMsg, resultMsg );
+    streamPtr->doneFlag = true;
+    pthread_cond_broadcast( &streamPtr->notEmpty );
+    pthread_mutex_unlock( &streamPtr->queueMutex );
+
+    // return from thread
+    return NULL;
+   }
+
+/*
+Name: openMetaDataBuffer
+Process: maps a metadata file into memory for in place parsing;
+         files that cannot be mapped (pipes, devices, empty files)
+         are read into a growing buffer instead
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: pointer to metadata buffer (MetaDataBuffer *)
+Function Output/Returned: Boolean result of file access (bool)
+Device Input/file: metadata file mapped or uploaded
+Device Output/device: none
+Dependencies: open, fstat, mmap, posix_madvise, read, malloc, realloc, free, close
+*/
+bool openMetaDataBuffer( const char *fileName, MetaDataBuffer *mdBuffer )
+   {
+    // initialize function/variables
+
+       // initialize stream read block size
+       const size_t READ_BLOCK_SIZE = 65536;
+
+       // initialize other variables
+       int fileDesc;
+       struct stat fileStat;
+       void *mapPtr;
+       char *readBuffer = NULL, *growBuffer;
+       size_t capacity = 0, readLength = 0;
+       ssize_t readCount;
+
+    // set buffer to empty
+    mdBuffer->data = NULL;
+    mdBuffer->length = 0;
+    mdBuffer->position = 0;
+    mdBuffer->mappedFlag = false;
+
+    // open file for reading, check for failure
+       // function: open
+    fileDesc = open( fileName, O_RDONLY );
+
+    if( fileDesc < 0 )
+       {
+        // return file access error
+        return false;
+       }
+
+    // check for regular, non empty file that can be mapped
+       // function: fstat
+    if( fstat( fileDesc, &fileStat ) == 0 
+                       && S_ISREG( fileStat.st_mode ) && fileStat.st_size > 0 )
+       {
+        // map whole file read only
+           // function: mmap
+        mapPtr = mmap( NULL, (size_t)fileStat.st_size, PROT_READ, 
+                                                    MAP_PRIVATE, fileDesc, 0 );
+
+        // check for mapping success
+        if( mapPtr != MAP_FAILED )
+           {
+            // hint sequential access to the kernel
+               // function: posix_madvise
+            posix_madvise( mapPtr, (size_t)fileStat.st_size, 
+                                                     POSIX_MADV_SEQUENTIAL );
+
+            // set mapped buffer
+            mdBuffer->data = (const char *)mapPtr;
+            mdBuffer->length = (size_t)fileStat.st_size;
+            mdBuffer->mappedFlag = true;
+
+            // mapping remains valid after close
+               // function: close
+            close( fileDesc );
+
+            // return success
+            return true;
+           }
+       }
+
+    // otherwise, read stream in blocks until end of data
+    do
+       {
+        // grow buffer as needed
+        if( capacity - readLength < READ_BLOCK_SIZE )
+           {
+            // double capacity
+               // function: realloc
+            capacity = capacity == 0 ? READ_BLOCK_SIZE : capacity * 2;
+            growBuffer = (char *)realloc( readBuffer, capacity );
+
+            // check for allocation failure
+            if( growBuffer == NULL )
+               {
+                // release partial buffer, file
+                   // function: free, close
+                free( readBuffer );
+                close( fileDesc );
+
+                // return access failure
+                return false;
+               }
+
+            readBuffer = growBuffer;
+           }
+
+        // read next block
+           // function: read
+        readCount = read( fileDesc, readBuffer + readLength, 
+                                                       capacity - readLength );
+
+        // add to length on success
+        if( readCount > 0 )
+           {
+            readLength += (size_t)readCount;
+           }
+       }
+    while( readCount > 0 );
+
+    // close file
+       // function: close
+    close( fileDesc );
+
+    // check for read error
+    if( readCount < 0 )
+       {
+        // release buffer
+           // function: free
+        free( readBuffer );
+
+        // return access failure
+        return false;
+       }
+
+    // set stream read buffer
+    mdBuffer->data = readBuffer;
+    mdBuffer->length = readLength;
+
+    // return success
+    return true;
+   }
+
+/*
+Name: strArgCodeToString
+Process: converts an interned first string argument code 
+         to its display string
+Function Input/Parameters: argument code (int)
+Function Output/Parameters: none
+Function Output/Returned: display string, empty if code invalid (const char *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+const char *strArgCodeToString( int code )
+   {
+    // check for code in table range
+    if( code >= ACCESS_ARG_CODE && code < BAD_ARG_CODE )
+       {
+        // return table string
+        return STR_ARG_STRINGS[ code ];
+       }
+
+    // return empty string
+    return "";
+   }
+
+/*
+Name: parseMetaDataChunk
+Process: chunk parser thread; parses op commands into the chunk's slice
+         of the whole op table with getOpCommand and counts start and 
+         end arguments until the end of the chunk (reported as 
+         OPCMD_ACCESS_ERR), the last op command, or the first error; a 
+         full slice is reported as an op command error, it never grows
+Function Input/Parameters: pointer to metadata chunk (void *)
+Function Output/Parameters: none
+Function Output/Returned: NULL (void *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: getOpCommand, updateStartCount, updateEndCount
+*/
+void *parseMetaDataChunk( void *arg )
+   {
+    // initialize function/variables
+    MetaDataChunk *chunkPtr = (MetaDataChunk *)arg;
+    OpCodeType newNode;
+    int accessResult;
+
+    // set empty chunk results, ops go in the chunk's table slice
+    chunkPtr->opTable.count = 0;
+    chunkPtr->startCount = 0;
+    chunkPtr->endCount = 0;
+    chunkPtr->lastOpEndPos = 0;
+
+    // get the first op command 
+       // function: getOpCommand
+    accessResult = getOpCommand( &chunkPtr->chunkBuffer, &newNode );
+
+    // loop while complete or last op commands are found
+    while( accessResult == COMPLETE_OPCMD_FOUND_MSG 
+                                     || accessResult == LAST_OPCMD_FOUND_MSG )
+       {
+        // check for slice full, otherwise add op to it
+        if( chunkPtr->opTable.count == chunkPtr->opTable.capacity )
+           {
+            accessResult = CORRUPT_OPCMD_ERR;
+            break;
+           }
+
+        chunkPtr->opTable.ops[ chunkPtr->opTable.count ] = newNode;
+        chunkPtr->opTable.ops[ chunkPtr->opTable.count ].lastOpFlag = false;
+        chunkPtr->opTable.count++;
+
+        // update start and end counts
+           // function: updateStartCount, updateEndCount
+        chunkPtr->startCount 
+                       = updateStartCount( chunkPtr->startCount, newNode.strArg1 );
+        chunkPtr->endCount 
+                           = updateEndCount( chunkPtr->endCount, newNode.strArg1 );
+
+        // check for last op command, keep end position
+        if( accessResult == LAST_OPCMD_FOUND_MSG )
+           {
+            chunkPtr->lastOpEndPos = chunkPtr->chunkBuffer.position;
+            break;
+           }
+
+        // get a new op command 
+           // function: getOpCommand
+        accessResult = getOpCommand( &chunkPtr->chunkBuffer, &newNode );
+       }
+
+    // set chunk result
+    chunkPtr->accessResult = accessResult;
+
+    // return from thread
+    return NULL;
+   }
+
+/*
+Name: pollStreamProcess
+Process: takes the next completed process block from the stream loader
+         if one is queued, without waiting
+Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+Function Output/Parameters: none
+Function Output/Returned: head of process op list, app start through app end,
+                          NULL when no block is queued (OpCodeType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_signal, pthread_mutex_unlock
+*/
+OpCodeType *pollStreamProcess( MetaDataStream *streamPtr )
+   {
+    // initialize function/variables
+    OpCodeType *blockHead = NULL;
+
+    // lock queue
+       // function: pthread_mutex_lock
+    pthread_mutex_lock( &streamPtr->queueMutex );
+
+    // check for block available
+    if( streamPtr->queueCount > 0 )
+       {
+        // take block from queue head
+        blockHead = streamPtr->blockQueue[ streamPtr->queueHead ];
+        streamPtr->queueHead 
+                         = ( streamPtr->queueHead + 1 ) % STREAM_QUEUE_CAPACITY;
+        streamPtr->queueCount--;
+
+        // wake loader if waiting on full queue
+           // function: pthread_cond_signal
+        pthread_cond_signal( &streamPtr->notFull );
+       }
+
+    // unlock queue
+       // function: pthread_mutex_unlock
+    pthread_mutex_unlock( &streamPtr->queueMutex );
+
+    // return block, or NULL if none queued
+    return blockHead;
+   }
+
+/*
+Name: pushStreamProcess
+Process: queues a completed process block for the simulator,
+         waits while the queue is full so the loader stays within
+         the in-flight window
+Function Input/Parameters: pointer to metadata stream (MetaDataStream *),
+                           head of process op list (OpCodeType *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result, false if the stream was
+                          cancelled and the block released (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_wait, pthread_cond_signal,
+              pthread_mutex_unlock, clearMetaDataList
+*/
+bool pushStreamProcess( MetaDataStream *streamPtr, OpCodeType *blockHead )
+   {
+    // initialize function/variables
+    bool queuedFlag = false;
+
+    // lock queue
+       // function: pthread_mutex_lock
+    pthread_mutex_lock( &streamPtr->queueMutex );
+
+    // wait for space or cancel
+       // function: pthread_cond_wait
+    while( streamPtr->queueCount == STREAM_QUEUE_CAPACITY 
+                                                    && !streamPtr->cancelFlag )
+       {
+        pthread_cond_wait( &streamPtr->notFull, &streamPtr->queueMutex );
+       }
+
+    // check for stream still running
+    if( !streamPtr->cancelFlag )
+       {
+        // add block at queue tail
+        streamPtr->blockQueue[ ( streamPtr->queueHead + streamPtr->queueCount )
+                                     % STREAM_QUEUE_CAPACITY ] = blockHead;
+        streamPtr->queueCount++;
+        queuedFlag = true;
+
+        // wake simulator if waiting for a block
+           // function: pthread_cond_signal
+        pthread_cond_signal( &streamPtr->notEmpty );
+       }
+
+    // unlock queue
+       // function: pthread_mutex_unlock
+    pthread_mutex_unlock( &streamPtr->queueMutex );
+
+    // release block not queued
+       // function: clearMetaDataList
+    if( !queuedFlag )
+       {
+        clearMetaDataList( blockHead );
+       }
+
+    // return queue result
+    return queuedFlag;
+   }
+
+/*
+Name: startMetaDataStream
+Process: opens a metadata file for in place parsing and starts
+         the stream loader thread, file access errors are reported
+         before any simulation starts
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: pointer to metadata stream (MetaDataStream *),
+                            result message if access fails (char *)
+Function Output/Returned: Boolean result of file access and thread start (bool)
+Device Input/file: none
+Device Output/device: none
+Dependencies: openMetaDataBuffer, copyString, pthread_mutex_init,
+              pthread_cond_init, pthread_create, closeMetaDataBuffer
+*/
+bool startMetaDataStream( const char *fileName, 
+                             MetaDataStream *streamPtr, char *endStateMsg )
+   {
+    // intialize end state message 
+       // function: copyString
+    copyString( endStateMsg, "Metadata file upload successful" ); 
+
+    // set empty queue and result
+    streamPtr->queueHead = 0;
+    streamPtr->queueCount = 0;
+    streamPtr->doneFlag = false;
+    streamPtr->cancelFlag = false;
+    streamPtr->successFlag = false;
+    streamPtr->endStateMsg[ 0 ] = NULL_CHAR;
+
+    // map or read file for parsing
+       // function: openMetaDataBuffer
+    if( !openMetaDataBuffer( fileName, &streamPtr->mdBuffer ) )
+       {
+        // set end state message, return file access error
+           // function: copyString
+        copyString( endStateMsg, "Metadata file access error" );
+        return false;
+       }
+
+    // initialize queue synchronization
+       // function: pthread_mutex_init, pthread_cond_init
+    pthread_mutex_init( &streamPtr->queueMutex, NULL );
+    pthread_cond_init( &streamPtr->notEmpty, NULL );
+    pthread_cond_init( &streamPtr->notFull, NULL );
+
+    // start loader thread, check for failure
+       // function: pthread_create
+    if( pthread_create( &streamPtr->loaderThread, NULL, 
+                                       loadMetaDataStream, streamPtr ) != 0 )
+       {
+        // release synchronization and file buffer
+           // function: pthread_mutex_destroy, pthread_cond_destroy,
+           //           closeMetaDataBuffer
+        pthread_mutex_destroy( &streamPtr->queueMutex );
+        pthread_cond_destroy( &streamPtr->notEmpty );
+        pthread_cond_destroy( &streamPtr->notFull );
+        closeMetaDataBuffer( &streamPtr->mdBuffer );
+
+        // set end state message, return failure
+           // function: copyString
+        copyString( endStateMsg, "Metadata loader thread start error" );
+        return false;
+       }
+
+    // return success
+    return true;
+   }
+
 /*
 Name: updateEndCount
 Process: manages count of "end" arguments to be compared at end
          of process input
 Function Input/Parameters: initial count (int)
-                           test string for "end" (const char *)
+                           argument code to test for "end" (int)
 Function Output/Parameters: none
-Function Output/Returned: updated count, if "end" string found, 
+Function Output/Returned: updated count, if "end" code found, 
                           otherwise no change
 Device Input/device: none
 Device Output/device: none
-Dependencies: compareString
+Dependencies: none
 */
-int updateEndCount( int count, const char *opString )
+int updateEndCount( int count, int argCode )
    {
-    // check for "end" in op string 
-       // function: compareString
-    if( compareString( opString, "end" ) == STR_EQ )
+    // check for "end" argument code 
+    if( argCode == END_ARG_CODE )
        {
         // return incremented end count
         return count + 1;
@@ -748,19 +2243,18 @@ Name: updateStartCount
 Process: manages count of "start" arguments to be compared at end
          of process input
 Function Input/Parameters: initial count (int)
-                           test string for "start" (const char *)
+                           argument code to test for "start" (int)
 Function Output/Parameters: none
-Function Output/Returned: updated count, if "start" string found, 
+Function Output/Returned: updated count, if "start" code found, 
                           otherwise no change
 Device Input/device: none
 Device Output/device: none
-Dependencies: compareString
+Dependencies: none
 */
-int updateStartCount( int count, const char *opString )
+int updateStartCount( int count, int argCode )
    {
-    // check for "start" in op string 
-       // function: compareString
-    if( compareString( opString, "start" ) == STR_EQ )
+    // check for "start" argument code 
+    if( argCode == START_ARG_CODE )
        {
         // return incremented end count
         return count + 1;
@@ -768,54 +2262,3 @@ int updateStartCount( int count, const char *opString )
     // return unchanged end count 
     return count;
    }
-
-/*
-Name: verifyFirstStringArg
-Process: checks for all possibilities of first argument string of op command
-Function Input/Parameters: test string (const char *)
-Function Output/Parameters: none
-Function Output/Returned: Boolean result of test (bool)
-Device Input/device: none
-Device Output/device: none
-Dependencies: compareString
-*/
-bool verifyFirstStringArg( const char *strArg )
-   {
-    // check for string holding correct first argument, return
-       // function: compareString
-    return ( compareString( strArg, "access" ) == STR_EQ
-        || compareString( strArg, "allocate" ) == STR_EQ
-        || compareString( strArg, "end" ) == STR_EQ
-        || compareString( strArg, "ethernet" ) == STR_EQ
-        || compareString( strArg, "hard drive" ) == STR_EQ
-        || compareString( strArg, "keyboard" ) == STR_EQ
-        || compareString( strArg, "monitor" ) == STR_EQ
-        || compareString( strArg, "printer" ) == STR_EQ
-        || compareString( strArg, "process" ) == STR_EQ
-        || compareString( strArg, "serial" ) == STR_EQ
-        || compareString( strArg, "sound signal" ) == STR_EQ
-        || compareString( strArg, "start" ) == STR_EQ
-        || compareString( strArg, "usb" ) == STR_EQ
-        || compareString( strArg, "video signal" ) == STR_EQ );
-   }
-
-/*
-Name: verifyValidCommand
-Process: checks for all possibilities of three-letter op code command
-Function Input/Parameters: test string (const char *)
-Function Output/Parameters: none
-Function Output/Returned: Boolean result of test (bool)
-Device Input/device: none
-Device Output/device: none
-Dependencies: compareString
-*/
-bool verifyValidCommand( char *testCmd )
-   {
-    // check for string holding three-letter op code command, return
-       // function: compareString
-    return ( compareString( testCmd, "sys" ) == STR_EQ
-        || compareString( testCmd, "app" ) == STR_EQ
-        || compareString( testCmd, "cpu" ) == STR_EQ
-        || compareString( testCmd, "mem" ) == STR_EQ
-        || compareString( testCmd, "dev" ) == STR_EQ );
-   }
\ No newline at end of file
@@ -6,24 +6,157 @@
 #include "datatypes.h"
 #include "StandardConstants.h"
 #include "StringUtils.h"
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 // constants
 
+// number of completed process blocks the stream loader may run ahead
+typedef enum { STREAM_QUEUE_CAPACITY = 16 } MetaDataStreamConstants;
+
+// parallel parser limits, smaller files are parsed by one thread
+typedef enum { MAX_PARSE_THREADS = 64,
+               PARALLEL_PARSE_MIN_SIZE = 1048576 } MetaDataParallelConstants;
+
+// interned three-letter op commands
+typedef enum { SYS_CMD_CODE,
+               APP_CMD_CODE,
+               CPU_CMD_CODE,
+               MEM_CMD_CODE,
+               DEV_CMD_CODE,
+               BAD_CMD_CODE } OpCommandCodes;
+
+// interned device in/out arguments
+typedef enum { NO_IO_CODE,
+               IN_IO_CODE,
+               OUT_IO_CODE,
+               BAD_IO_CODE } OpInOutCodes;
+
+// interned first string arguments, devices and actions
+typedef enum { ACCESS_ARG_CODE,
+               ALLOCATE_ARG_CODE,
+               END_ARG_CODE,
+               ETHERNET_ARG_CODE,
+               HARD_DRIVE_ARG_CODE,
+               KEYBOARD_ARG_CODE,
+               MONITOR_ARG_CODE,
+               PRINTER_ARG_CODE,
+               PROCESS_ARG_CODE,
+               SERIAL_ARG_CODE,
+               SOUND_SIGNAL_ARG_CODE,
+               START_ARG_CODE,
+               USB_ARG_CODE,
+               VIDEO_SIGNAL_ARG_CODE,
+               BAD_ARG_CODE } OpArgCodes;
+
+// decoded operations, one per command and argument combination
+typedef enum { SYS_START_OP,
+               SYS_END_OP,
+               APP_START_OP,
+               APP_END_OP,
+               CPU_PROCESS_OP,
+               DEV_IN_OP,
+               DEV_OUT_OP,
+               MEM_ALLOCATE_OP,
+               MEM_ACCESS_OP,
+               UNDECODED_OP } OpDecodeCodes;
+
+// packed op code record, 24 bytes, string members are stored as interned
+// codes, opKind and opTime are filled by the simulator decode stage;
+// ops of a list are contiguous table entries, the last one flagged,
+// stepped through by nextOpCode
 typedef struct OpCodeType
 {
     int pid;
-    char command[MAX_STR_LEN];
-    char inOutArg[MAX_STR_LEN];
-    char strArg1[MAX_STR_LEN];
     int intArg2;
     int intArg3;
-    double opEndTime;
-    struct OpCodeType *nextNode;
+    int opTime;
+    unsigned char command;
+    unsigned char inOutArg;
+    unsigned char strArg1;
+    unsigned char opKind;
+    bool lastOpFlag;
 } OpCodeType;
 
+// contiguous, growable op code table built by getMetaData
+typedef struct OpCodeTable
+{
+    OpCodeType *ops;
+    int count;
+    int capacity;
+} OpCodeTable;
+
+// metadata file contents, mapped from the file or read from a stream
+typedef struct MetaDataBuffer
+{
+    const char *data;
+    size_t length;
+    size_t position;
+    bool mappedFlag;
+} MetaDataBuffer;
+
+// pipelined metadata loader, a loader thread parses the file and
+// queues each completed app start ... app end block as its own op list
+typedef struct MetaDataStream
+{
+    MetaDataBuffer mdBuffer;
+    pthread_t loaderThread;
+    pthread_mutex_t queueMutex;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    OpCodeType *blockQueue[STREAM_QUEUE_CAPACITY];
+    int queueHead;
+    int queueCount;
+    bool doneFlag;
+    bool cancelFlag;
+    bool successFlag;
+    char endStateMsg[MAX_STR_LEN];
+} MetaDataStream;
+
+// one section of a metadata buffer parsed by its own thread,
+// the section buffer shares the file data and ends at a delimiter;
+// its op table is a fixed slice of the whole upload table
+typedef struct MetaDataChunk
+{
+    MetaDataBuffer chunkBuffer;
+    OpCodeTable opTable;
+    int startCount;
+    int endCount;
+    int accessResult;
+    size_t lastOpEndPos;
+    pthread_t thread;
+    bool startedFlag;
+} MetaDataChunk;
+
+// load time summary of one app start ... app end process,
+// first op is the table position of its app start op
+typedef struct ProcessIndexType
+{
+    OpCodeType *appStart;
+    int firstOp;
+    int opCount;
+    int cpuCycles;
+    int ioCycles;
+    int memOpCount;
+} ProcessIndexType;
+
+// process index in metadata order, one entry per process
+typedef struct ProcessIndexTable
+{
+    ProcessIndexType *procs;
+    int count;
+    int capacity;
+} ProcessIndexTable;
+
+// non-owning view of one token inside a metadata buffer
+typedef struct MetaDataView
+{
+    const char *str;
+    int length;
+} MetaDataView;
+
 
 typedef enum { BAD_ARG_VAL = -1, 
                NO_ACCESS_ERR,
@@ -40,24 +173,73 @@ typedef enum { BAD_ARG_VAL = -1,
 // Function prototypes
 
 /*
- Name: addNode
- Process: adds metadata node to linked list recursively, handles empty list condition
- Function Input/Parameters: pointer to head or next linked node (OpCodeType *),
-                            pointer to new node (OpCodeType *)
- Function Output/Parameters: none
- Function Output/Returned: pointer to previous node, or head node (OpCodeType *)
+ Name: addOpCode
+ Process: appends a copy of an op code to the end of the op code table,
+          growing the table as needed
+ Function Input/Parameters: pointer to op code table (OpCodeTable *),
+                            pointer to new op code (const OpCodeType *)
+ Function Output/Parameters: updated op code table (OpCodeTable *)
+ Function Output/Returned: Boolean result of allocation (bool)
+ */
+bool addOpCode( OpCodeTable *table, const OpCodeType *newNode );
+
+/*
+ Name: buildProcessIndex
+ Process: one pass over the op code list, adds an index entry
+          for each app start ... app end process
+ Function Input/Parameters: head of op code list (OpCodeType *)
+ Function Output/Parameters: pointer to empty process index (ProcessIndexTable *)
+ Function Output/Returned: Boolean result of allocation (bool)
  */
-OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode );
+bool buildProcessIndex( OpCodeType *opCodeDataHead, 
+                                              ProcessIndexTable *indexPtr );
 
 /*
  Name: clearMetaDataList
- Process: recursively traverses list, frees dynamically allocated nodes
- Function Input/Parameters: node op code (const OpCodeType *)
+ Process: frees the op code table, given the head of the op code list
+ Function Input/Parameters: head of op code list (OpCodeType *)
  Function Output/Parameters: none
  Function Output/Returned: NULL (OpCodeType *)
  */
 OpCodeType *clearMetaDataList( OpCodeType *localPtr );
 
+/*
+ Name: clearProcessIndex
+ Process: frees the process index entries, op codes are not released
+ Function Input/Parameters: pointer to process index (ProcessIndexTable *)
+ Function Output/Parameters: empty process index (ProcessIndexTable *)
+ Function Output/Returned: none
+ */
+void clearProcessIndex( ProcessIndexTable *indexPtr );
+
+/*
+ Name: closeMetaDataBuffer
+ Process: unmaps or frees metadata buffer contents
+ Function Input/Parameters: pointer to metadata buffer (MetaDataBuffer *)
+ Function Output/Parameters: cleared metadata buffer (MetaDataBuffer *)
+ Function Output/Returned: none
+ */
+void closeMetaDataBuffer( MetaDataBuffer *mdBuffer );
+
+/*
+ Name: compareViewString
+ Process: compares a buffer view with a c-style string, same results
+          as compareString
+ Function Input/Parameters: view into metadata buffer (MetaDataView),
+                            c-style test string (const char *)
+ Function Output/Returned: result as specified by compareString (int)
+ */
+int compareViewString( MetaDataView testView, const char *otherStr );
+
+/*
+ Name: commandCodeToString
+ Process: converts an interned op command code to its display string
+ Function Input/Parameters: op command code (int)
+ Function Output/Parameters: none
+ Function Output/Returned: display string (const char *)
+ */
+const char *commandCodeToString( int code );
+
 /*
  Name: displayMetaData
  Process: data dump/display of all op code items
@@ -67,15 +249,48 @@ OpCodeType *clearMetaDataList( OpCodeType *localPtr );
  */
 void displayMetaData( const OpCodeType *localPtr );
 
+/*
+ Name: getArgCode
+ Process: interns a first string argument of an op command
+ Function Input/Parameters: argument view (MetaDataView)
+ Function Output/Returned: argument code, BAD_ARG_CODE if invalid (OpArgCodes)
+ */
+OpArgCodes getArgCode( MetaDataView argView );
+
+/*
+ Name: finishMetaDataStream
+ Process: stops and joins the stream loader, releases unconsumed blocks
+ Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+ Function Output/Parameters: result message of loading (char *)
+ Function Output/Returned: Boolean result of loading (bool)
+ */
+bool finishMetaDataStream( MetaDataStream *streamPtr, char *endStateMsg );
+
 /*
  Name: getCommand
  Process: parses three-letter command part of op code string
- Function Input/Parameters: input op code string (const char *),
+ Function Input/Parameters: input op code view (MetaDataView),
                             starting index (int)
- Function Output/Parameters: parsed command (char *)
+ Function Output/Parameters: parsed command view (MetaDataView *)
  Function Output/Returned: updated starting index for use by calling function (int)
  */
-int getCommand( char *cmd, const char *inputStr, int index );
+int getCommand( MetaDataView *cmd, MetaDataView inputView, int index );
+
+/*
+ Name: getCommandCode
+ Process: interns a three-letter op command
+ Function Input/Parameters: command view (MetaDataView)
+ Function Output/Returned: command code, BAD_CMD_CODE if invalid (OpCommandCodes)
+ */
+OpCommandCodes getCommandCode( MetaDataView cmdView );
+
+/*
+ Name: getInOutCode
+ Process: interns a device in/out argument
+ Function Input/Parameters: in/out argument view (MetaDataView)
+ Function Output/Returned: in/out code, BAD_IO_CODE if invalid (OpInOutCodes)
+ */
+OpInOutCodes getInOutCode( MetaDataView ioView );
 
 /*
  Name: getMetaData
@@ -87,35 +302,96 @@ int getCommand( char *cmd, const char *inputStr, int index );
  */
 bool getMetaData( const char *fileName, OpCodeType **opCodeDataHead, char *endStateMsg );
 
+/*
+ Name: getMetaDataParallel
+ Process: parallel upload driver, splits the op commands into chunks
+          at op delimiters, parses each chunk on its own thread,
+          then stitches chunk tables and checks start/end balance;
+          same results and messages as getMetaData
+ Function Input/Parameters: file name (const char *),
+                            number of threads, zero for all online cores (int)
+ Function Output/Parameters: pointer to op code list head pointer (OpCodeType **),
+                             result message of function state after completion (char *)
+ Function Output/Returned: Boolean result of operation (bool)
+ */
+bool getMetaDataParallel( const char *fileName, OpCodeType **opCodeDataHead,
+                                           char *endStateMsg, int numThreads );
+
 /*
  Name: getOpCommand
- Process: acquires one op command line from a previously opened file, parses it,
-          and sets various struct members according to the three-letter command
- Function Input/Parameters: pointer to open file handle (FILE *),
+ Process: acquires one op command from a previously opened metadata buffer,
+          parses it in place, and sets various struct members according
+          to the three-letter command
+ Function Input/Parameters: pointer to open metadata buffer (MetaDataBuffer *),
                             pointer to one op code struct (OpCodeType *)
  Function Output/Returned: code result of operation (OpCodeMessages)
  */
-OpCodeMessages getOpCommand( FILE *filePtr, OpCodeType *inData );
+OpCodeMessages getOpCommand( MetaDataBuffer *mdBuffer, OpCodeType *inData );
+
+/*
+ Name: getStreamProcess
+ Process: waits for the next completed process block from the stream loader
+ Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+ Function Output/Parameters: none
+ Function Output/Returned: head of process op list, app start through app end,
+                           NULL when loading has ended (OpCodeType *)
+ */
+OpCodeType *getStreamProcess( MetaDataStream *streamPtr );
 
 /*
  Name: getNumberArg
  Process: starts at given index, captures and assembles integer argument,
           and returns as parameter
- Function Input/Parameters: input string (const char *),
+ Function Input/Parameters: input op code view (MetaDataView),
                             starting index (int)
  Function Output/Returned: updated index for next function start (int)
  */
-int getNumberArg( int *number, const char *inputStr, int index );
+int getNumberArg( int *number, MetaDataView inputView, int index );
 
 /*
  Name: getStringArg
  Process: starts at given index, captures and assembles string argument,
           and returns as parameter
- Function Input/Parameters: input string (const char *),
+ Function Input/Parameters: input op code view (MetaDataView),
                             starting index (int)
+ Function Output/Parameters: captured argument view (MetaDataView *)
  Function Output/Returned: updated index for next function start (int)
  */
-int getStringArg( char *strArg, const char *inputStr, int index );
+int getStringArg( MetaDataView *strArg, MetaDataView inputView, int index );
+
+/*
+ Name: getViewToDelimiter
+ Process: captures a view of the metadata buffer up to a specified delimiter
+          or non printable character, with the same rules
+          as getStringToDelimiter but without copying
+ Function Input/Parameters: pointer to open metadata buffer (MetaDataBuffer *),
+                            delimiter (char)
+ Function Output/Parameters: captured view (MetaDataView *)
+ Function Output/Returned: success of operation (bool)
+ */
+bool getViewToDelimiter( MetaDataBuffer *mdBuffer, 
+                                   char delimiter, MetaDataView *capturedView );
+
+/*
+ Name: inOutCodeToString
+ Process: converts an interned device in/out code to its display string
+ Function Input/Parameters: in/out code (int)
+ Function Output/Parameters: none
+ Function Output/Returned: display string (const char *)
+ */
+const char *inOutCodeToString( int code );
+
+/*
+ Name: indexProcess
+ Process: summarizes one process from its app start op to its app end op
+ Function Input/Parameters: app start op code (OpCodeType *),
+                            table position of app start op (int)
+ Function Output/Parameters: pointer to index entry (ProcessIndexType *)
+ Function Output/Returned: op code after the process, NULL at list end
+                           (OpCodeType *)
+ */
+OpCodeType *indexProcess( OpCodeType *appStartPtr, int firstOp, 
+                                                ProcessIndexType *procPtr );
 
 /*
  Name: isDigit
@@ -126,37 +402,112 @@ int getStringArg( char *strArg, const char *inputStr, int index );
 bool isDigit( char testChar );
 
 /*
- Name: updateEndCount
- Process: manages count of "end" arguments to be compared at end of process input
- Function Input/Parameters: initial count (int),
-                            test string for "end" (const char *)
- Function Output/Returned: updated count, if "end" string found, otherwise no change (int)
+ Name: linkOpCodeTable
+ Process: flags the last table entry so the table can also be
+          traversed as the op code list
+ Function Input/Parameters: pointer to op code table (OpCodeTable *)
+ Function Output/Parameters: linked op code table (OpCodeTable *)
+ Function Output/Returned: head of op code list, NULL if empty (OpCodeType *)
  */
-int updateEndCount( int count, const char *opString );
+OpCodeType *linkOpCodeTable( OpCodeTable *table );
 
 /*
- Name: updateStartCount
- Process: manages count of "start" arguments to be compared at end of process input
- Function Input/Parameters: initial count (int),
-                            test string for "start" (const char *)
- Function Output/Returned: updated count, if "start" string found, otherwise no change (int)
+ Name: nextOpCode
+ Process: steps to the following op of a linked op code table
+ Function Input/Parameters: op code in list (const OpCodeType *)
+ Function Output/Parameters: none
+ Function Output/Returned: next op code, NULL at list end (OpCodeType *)
  */
-int updateStartCount( int count, const char *opString );
+OpCodeType *nextOpCode( const OpCodeType *opPtr );
 
 /*
- Name: verifyFirstStringArg
- Process: checks for all possibilities of the first argument string of op command
- Function Input/Parameters: test string (const char *)
- Function Output/Returned: Boolean result of test (bool)
+ Name: loadMetaDataStream
+ Process: stream loader thread, parses op commands and queues each
+          completed process block, records the load result when done
+ Function Input/Parameters: pointer to metadata stream (void *)
+ Function Output/Parameters: none
+ Function Output/Returned: NULL (void *)
  */
-bool verifyFirstStringArg( const char *strArg );
+void *loadMetaDataStream( void *arg );
 
 /*
- Name: verifyValidCommand
- Process: checks for all possibilities of the three-letter op code command
- Function Input/Parameters: test string (const char *)
- Function Output/Returned: Boolean result of test (bool)
+ Name: openMetaDataBuffer
+ Process: maps a metadata file into memory for in place parsing,
+          falls back to reading the whole stream for pipes
+          and other unmappable files
+ Function Input/Parameters: file name (const char *)
+ Function Output/Parameters: pointer to metadata buffer (MetaDataBuffer *)
+ Function Output/Returned: Boolean result of file access (bool)
+ */
+bool openMetaDataBuffer( const char *fileName, MetaDataBuffer *mdBuffer );
+
+/*
+ Name: parseMetaDataChunk
+ Process: chunk parser thread, parses op commands into its table slice
+          to the end of its chunk or to the last op command or first error
+ Function Input/Parameters: pointer to metadata chunk (void *)
+ Function Output/Parameters: none
+ Function Output/Returned: NULL (void *)
+ */
+void *parseMetaDataChunk( void *arg );
+
+/*
+ Name: pollStreamProcess
+ Process: takes the next completed process block if one is queued, no wait
+ Function Input/Parameters: pointer to running metadata stream (MetaDataStream *)
+ Function Output/Parameters: none
+ Function Output/Returned: head of process op list, app start through app end,
+                           NULL when no block is queued (OpCodeType *)
+ */
+OpCodeType *pollStreamProcess( MetaDataStream *streamPtr );
+
+/*
+ Name: pushStreamProcess
+ Process: queues a completed process block, waiting while the queue is full
+ Function Input/Parameters: pointer to metadata stream (MetaDataStream *),
+                            head of process op list (OpCodeType *)
+ Function Output/Parameters: none
+ Function Output/Returned: Boolean result, false if the stream was
+                           cancelled and the block released (bool)
+ */
+bool pushStreamProcess( MetaDataStream *streamPtr, OpCodeType *blockHead );
+
+/*
+ Name: startMetaDataStream
+ Process: opens a metadata file and starts the stream loader thread
+ Function Input/Parameters: file name (const char *)
+ Function Output/Parameters: pointer to metadata stream (MetaDataStream *),
+                             result message if file access fails (char *)
+ Function Output/Returned: Boolean result of file access and thread start (bool)
+ */
+bool startMetaDataStream( const char *fileName, 
+                            MetaDataStream *streamPtr, char *endStateMsg );
+
+/*
+ Name: strArgCodeToString
+ Process: converts an interned first string argument code to its display string
+ Function Input/Parameters: argument code (int)
+ Function Output/Parameters: none
+ Function Output/Returned: display string (const char *)
+ */
+const char *strArgCodeToString( int code );
+
+/*
+ Name: updateEndCount
+ Process: manages count of "end" arguments to be compared at end of process input
+ Function Input/Parameters: initial count (int),
+                            argument code to test for "end" (int)
+ Function Output/Returned: updated count, if "end" code found, otherwise no change (int)
+ */
+int updateEndCount( int count, int argCode );
+
+/*
+ Name: updateStartCount
+ Process: manages count of "start" arguments to be compared at end of process input
+ Function Input/Parameters: initial count (int),
+                            argument code to test for "start" (int)
+ Function Output/Returned: updated count, if "start" code found, otherwise no change (int)
  */
-bool verifyValidCommand( char *testCmd );
+int updateStartCount( int count, int argCode );
 
 #endif // METADATA_OPS_H
\ No newline at end of file
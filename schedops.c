@@ -0,0 +1,1332 @@
+// header files
+#include "schedops.h"
+#include "simulator.h"
+
+/*
+Name: appendReadyQueue
+Process: keys a PCB and adds it at the heap end without sifting, for
+         a bulk build finished by heapifyReadyQueue; for MLFQ, adds it
+         at the tail of its level; for CFS, inserts it in the tree
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: Boolean result, false if out of memory (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: keyReadyPCB, linkLevelPCB, linkTreePCB, growReadyQueue
+*/
+bool appendReadyQueue( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    // check for MLFQ, link at level tail
+       // function: keyReadyPCB, linkLevelPCB
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        keyReadyPCB( queuePtr, pcbPtr );
+        linkLevelPCB( queuePtr, pcbPtr );
+
+        return true;
+       }
+
+    // check for CFS, insert in tree
+       // function: keyReadyPCB, linkTreePCB
+    if( queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        keyReadyPCB( queuePtr, pcbPtr );
+        linkTreePCB( queuePtr, pcbPtr );
+
+        return true;
+       }
+
+    // make room for one more
+       // function: growReadyQueue
+    if( !growReadyQueue( queuePtr, queuePtr->count + 1 ) )
+       {
+        return false;
+       }
+
+    // key PCB, place at end
+       // function: keyReadyPCB
+    keyReadyPCB( queuePtr, pcbPtr );
+
+    pcbPtr->queueIndex = queuePtr->count;
+    queuePtr->heap[ queuePtr->count ] = pcbPtr;
+    queuePtr->count++;
+
+    // return success
+    return true;
+   }
+
+/*
+Name: boostReadyQueue
+Process: MLFQ priority boost; splices every level list onto the end of
+         level 0, in level order, and starts a new epoch, so queued, 
+         running and blocked PCBs alike read as level 0 from now on, 
+         without visiting any of them, O(levels)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void boostReadyQueue( ReadyQueueType *queuePtr )
+   {
+    int level;
+
+    // splice each lower level list after level 0
+    for( level = 1; level < queuePtr->levelCount; level++ )
+       {
+        if( queuePtr->levelHead[ level ] != NULL )
+           {
+            if( queuePtr->levelTail[ 0 ] == NULL )
+               {
+                queuePtr->levelHead[ 0 ] = queuePtr->levelHead[ level ];
+               }
+            else
+               {
+                queuePtr->levelTail[ 0 ]->nextReady 
+                                                = queuePtr->levelHead[ level ];
+                queuePtr->levelHead[ level ]->prevReady 
+                                                   = queuePtr->levelTail[ 0 ];
+               }
+
+            queuePtr->levelTail[ 0 ] = queuePtr->levelTail[ level ];
+            queuePtr->levelHead[ level ] = NULL;
+            queuePtr->levelTail[ level ] = NULL;
+           }
+       }
+
+    // only level 0 is left, start new epoch
+    queuePtr->levelMap = queuePtr->levelHead[ 0 ] != NULL ? 1u : 0u;
+    queuePtr->boostEpoch++;
+   }
+
+/*
+Name: clearReadyQueue
+Process: releases the ready queue heap and empties the MLFQ levels and
+         CFS tree, queued PCBs are not released
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: cleared ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: free, memset
+*/
+void clearReadyQueue( ReadyQueueType *queuePtr )
+   {
+    // release heap
+       // function: free
+    free( queuePtr->heap );
+
+    queuePtr->heap = NULL;
+    queuePtr->count = 0;
+    queuePtr->capacity = 0;
+
+    // drop MLFQ level lists
+       // function: memset
+    memset( queuePtr->levelHead, 0, sizeof( queuePtr->levelHead ) );
+    memset( queuePtr->levelTail, 0, sizeof( queuePtr->levelTail ) );
+    queuePtr->levelMap = 0;
+
+    // drop CFS tree
+    queuePtr->treeRoot = NULL;
+    queuePtr->treeLeftmost = NULL;
+   }
+
+/*
+Name: growReadyQueue
+Process: makes room for a number of queued PCBs, growing by doubling
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           number of PCBs to hold (int)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: Boolean result, false if out of memory (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: realloc
+*/
+bool growReadyQueue( ReadyQueueType *queuePtr, int needCount )
+   {
+    // initialize function/variables
+    PCBType **newHeap;
+    int newCapacity = queuePtr->capacity;
+
+    // check for room already
+    if( needCount <= queuePtr->capacity )
+       {
+        return true;
+       }
+
+    // double until large enough
+    if( newCapacity < READY_QUEUE_MIN_CAPACITY )
+       {
+        newCapacity = READY_QUEUE_MIN_CAPACITY;
+       }
+
+    while( newCapacity < needCount )
+       {
+        newCapacity *= 2;
+       }
+
+    // resize heap
+       // function: realloc
+    newHeap = (PCBType **)realloc( queuePtr->heap,
+                                           newCapacity * sizeof( PCBType * ) );
+
+    if( newHeap == NULL )
+       {
+        return false;
+       }
+
+    queuePtr->heap = newHeap;
+    queuePtr->capacity = newCapacity;
+
+    // return success
+    return true;
+   }
+
+/*
+Name: heapifyReadyQueue
+Process: restores heap order over appended PCBs from the last parent 
+         up to the root, O(n) instead of n sifted pushes; MLFQ level 
+         lists and the CFS tree are in order as appended
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: siftDownReadyQueue
+*/
+void heapifyReadyQueue( ReadyQueueType *queuePtr )
+   {
+    int index;
+
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE 
+                               || queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        return;
+       }
+
+    for( index = queuePtr->count / 2 - 1; index >= 0; index-- )
+       {
+        siftDownReadyQueue( queuePtr, index );
+       }
+   }
+
+/*
+Name: initInterruptQueue
+Process: sets up an empty interrupt queue, head and tail on its stub node
+Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *)
+Function Output/Parameters: empty interrupt queue (InterruptQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void initInterruptQueue( InterruptQueueType *queuePtr )
+   {
+    queuePtr->stub.pcbPtr = NULL;
+    queuePtr->stub.next = NULL;
+    queuePtr->head = &queuePtr->stub;
+    queuePtr->tail = &queuePtr->stub;
+   }
+
+/*
+Name: initReadyQueue
+Process: sets up an empty ready queue ordered for a scheduling policy,
+         with its MLFQ levels and CFS tree empty
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           cpu scheduling code (int),
+                           MLFQ level count (int)
+Function Output/Parameters: empty ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void initReadyQueue( ReadyQueueType *queuePtr, int schedCode, 
+                                                            int levelCount )
+   {
+    int level;
+
+    queuePtr->heap = NULL;
+    queuePtr->count = 0;
+    queuePtr->capacity = 0;
+    queuePtr->schedCode = schedCode;
+    queuePtr->queueCounter = 0;
+
+    for( level = 0; level < MLFQ_MAX_LEVELS; level++ )
+       {
+        queuePtr->levelHead[ level ] = NULL;
+        queuePtr->levelTail[ level ] = NULL;
+       }
+
+    queuePtr->levelMap = 0;
+    queuePtr->levelCount = levelCount < 1 ? 1 : ( levelCount 
+                       > MLFQ_MAX_LEVELS ? MLFQ_MAX_LEVELS : levelCount );
+    queuePtr->boostEpoch = 0;
+
+    queuePtr->treeRoot = NULL;
+    queuePtr->treeLeftmost = NULL;
+    queuePtr->minVruntime = 0;
+   }
+
+/*
+Name: isPreemptivePolicy
+Process: reports whether a scheduling policy preempts on quantum expiry
+Function Input/Parameters: cpu scheduling code (int)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result, true for _P policies (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+bool isPreemptivePolicy( int schedCode )
+   {
+    return schedCode == CPU_SCHED_SRTF_P_CODE
+              || schedCode == CPU_SCHED_FCFS_P_CODE
+                 || schedCode == CPU_SCHED_RR_P_CODE
+                    || schedCode == CPU_SCHED_MLFQ_CODE
+                                         || schedCode == CPU_SCHED_CFS_CODE;
+   }
+
+/*
+Name: keyReadyPCB
+Process: sets the policy key of a PCB, FCFS by PID, SJF and SRTF by
+         time remaining, RR by queue order, CFS by virtual runtime, 
+         first raised to the queue floor; queue order breaks ties
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: keyed PCB (PCBType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void keyReadyPCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    pcbPtr->queueOrder = queuePtr->queueCounter;
+    queuePtr->queueCounter++;
+
+    switch( queuePtr->schedCode )
+       {
+        case CPU_SCHED_SJF_N_CODE:
+        case CPU_SCHED_SRTF_P_CODE:
+
+           pcbPtr->queueKey = pcbPtr->timeLeft;
+           break;
+
+        case CPU_SCHED_RR_P_CODE:
+
+           pcbPtr->queueKey = pcbPtr->queueOrder;
+           break;
+
+        case CPU_SCHED_CFS_CODE:
+
+           if( pcbPtr->vruntime < queuePtr->minVruntime )
+              {
+               pcbPtr->vruntime = queuePtr->minVruntime;
+              }
+
+           pcbPtr->queueKey = pcbPtr->vruntime;
+           break;
+
+        default:
+
+           pcbPtr->queueKey = (long long)pcbPtr->PID;
+           break;
+       }
+   }
+
+/*
+Name: levelReadyPCB
+Process: reports the MLFQ level of a PCB; a level set before the last
+         boost is stale, the PCB was boosted, so it is reset to 0 first
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: current PCB level (PCBType *)
+Function Output/Returned: level, 0 the highest (int)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+int levelReadyPCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    if( pcbPtr->levelEpoch != queuePtr->boostEpoch )
+       {
+        pcbPtr->queueLevel = 0;
+        pcbPtr->levelEpoch = queuePtr->boostEpoch;
+       }
+
+    return pcbPtr->queueLevel;
+   }
+
+/*
+Name: linkTreePCB
+Process: inserts a keyed PCB into the CFS red-black tree as a red leaf,
+         after any equal keys, then recolors and rotates up the tree 
+         until no red node has a red parent; the PCB is the new cached
+         leftmost if it never went right on the way down, and the
+         virtual runtime floor rises to the leftmost key, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: readyQueueBefore, rotateTreeLeft, rotateTreeRight
+*/
+void linkTreePCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    PCBType *parentPtr = NULL, *nodePtr = queuePtr->treeRoot;
+    PCBType *grandPtr, *unclePtr;
+    bool leftmostFlag = true;
+
+    // walk down to a leaf
+       // function: readyQueueBefore
+    while( nodePtr != NULL )
+       {
+        parentPtr = nodePtr;
+
+        if( readyQueueBefore( pcbPtr, nodePtr ) )
+           {
+            nodePtr = nodePtr->treeLeft;
+           }
+        else
+           {
+            nodePtr = nodePtr->treeRight;
+            leftmostFlag = false;
+           }
+       }
+
+    // link as red leaf
+    pcbPtr->treeParent = parentPtr;
+    pcbPtr->treeLeft = NULL;
+    pcbPtr->treeRight = NULL;
+    pcbPtr->treeRed = true;
+
+    if( parentPtr == NULL )
+       {
+        queuePtr->treeRoot = pcbPtr;
+       }
+    else if( readyQueueBefore( pcbPtr, parentPtr ) )
+       {
+        parentPtr->treeLeft = pcbPtr;
+       }
+    else
+       {
+        parentPtr->treeRight = pcbPtr;
+       }
+
+    if( leftmostFlag )
+       {
+        queuePtr->treeLeftmost = pcbPtr;
+       }
+
+    pcbPtr->queueIndex = 0;
+    queuePtr->count++;
+
+    // fix red parents up the tree
+       // function: rotateTreeLeft, rotateTreeRight
+    nodePtr = pcbPtr;
+
+    while( ( parentPtr = nodePtr->treeParent ) != NULL 
+                                                    && parentPtr->treeRed )
+       {
+        grandPtr = parentPtr->treeParent;
+
+        if( parentPtr == grandPtr->treeLeft )
+           {
+            unclePtr = grandPtr->treeRight;
+
+            // check for red uncle, push black down from grandparent
+            if( unclePtr != NULL && unclePtr->treeRed )
+               {
+                parentPtr->treeRed = false;
+                unclePtr->treeRed = false;
+                grandPtr->treeRed = true;
+                nodePtr = grandPtr;
+               }
+
+            // otherwise, rotate parent over grandparent
+            else
+               {
+                if( nodePtr == parentPtr->treeRight )
+                   {
+                    rotateTreeLeft( queuePtr, parentPtr );
+                    nodePtr = parentPtr;
+                    parentPtr = nodePtr->treeParent;
+                   }
+
+                parentPtr->treeRed = false;
+                grandPtr->treeRed = true;
+                rotateTreeRight( queuePtr, grandPtr );
+               }
+           }
+        else
+           {
+            unclePtr = grandPtr->treeLeft;
+
+            if( unclePtr != NULL && unclePtr->treeRed )
+               {
+                parentPtr->treeRed = false;
+                unclePtr->treeRed = false;
+                grandPtr->treeRed = true;
+                nodePtr = grandPtr;
+               }
+            else
+               {
+                if( nodePtr == parentPtr->treeLeft )
+                   {
+                    rotateTreeRight( queuePtr, parentPtr );
+                    nodePtr = parentPtr;
+                    parentPtr = nodePtr->treeParent;
+                   }
+
+                parentPtr->treeRed = false;
+                grandPtr->treeRed = true;
+                rotateTreeLeft( queuePtr, grandPtr );
+               }
+           }
+       }
+
+    queuePtr->treeRoot->treeRed = false;
+
+    // raise floor to leftmost
+    if( queuePtr->treeLeftmost->queueKey > queuePtr->minVruntime )
+       {
+        queuePtr->minVruntime = queuePtr->treeLeftmost->queueKey;
+       }
+   }
+
+/*
+Name: linkLevelPCB
+Process: adds a PCB at the tail of its MLFQ level list and marks the 
+         level non-empty, O(1)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: levelReadyPCB
+*/
+void linkLevelPCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    int level = levelReadyPCB( queuePtr, pcbPtr );
+
+    pcbPtr->prevReady = queuePtr->levelTail[ level ];
+    pcbPtr->nextReady = NULL;
+
+    if( queuePtr->levelTail[ level ] == NULL )
+       {
+        queuePtr->levelHead[ level ] = pcbPtr;
+       }
+    else
+       {
+        queuePtr->levelTail[ level ]->nextReady = pcbPtr;
+       }
+
+    queuePtr->levelTail[ level ] = pcbPtr;
+    queuePtr->levelMap |= 1u << level;
+
+    pcbPtr->queueIndex = level;
+    queuePtr->count++;
+   }
+
+/*
+Name: moveTreePCB
+Process: puts one CFS tree node, or none, in place of another under the
+         replaced node's parent; children are left to the caller
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to replaced PCB (PCBType *),
+                           pointer to replacing PCB, may be NULL (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void moveTreePCB( ReadyQueueType *queuePtr, PCBType *oldPtr, 
+                                                          PCBType *newPtr )
+   {
+    PCBType *parentPtr = oldPtr->treeParent;
+
+    if( parentPtr == NULL )
+       {
+        queuePtr->treeRoot = newPtr;
+       }
+    else if( oldPtr == parentPtr->treeLeft )
+       {
+        parentPtr->treeLeft = newPtr;
+       }
+    else
+       {
+        parentPtr->treeRight = newPtr;
+       }
+
+    if( newPtr != NULL )
+       {
+        newPtr->treeParent = parentPtr;
+       }
+   }
+
+/*
+Name: peekReadyQueue
+Process: reports the next process to dispatch, leaving it queued
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: none
+Function Output/Returned: next PCB, NULL if empty (PCBType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+PCBType *peekReadyQueue( ReadyQueueType *queuePtr )
+   {
+    if( queuePtr->count == 0 )
+       {
+        return NULL;
+       }
+
+    // check for MLFQ, head of highest non-empty level, lowest set bit
+       // function: __builtin_ctz
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        return queuePtr->levelHead[ __builtin_ctz( queuePtr->levelMap ) ];
+       }
+
+    // check for CFS, cached leftmost node
+    if( queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        return queuePtr->treeLeftmost;
+       }
+
+    return queuePtr->heap[ 0 ];
+   }
+
+/*
+Name: popInterruptQueue
+Process: removes the oldest interrupt, consumer only; steps past the 
+         stub, and when the last node is taken puts the stub back behind
+         it so the tail never reaches an empty list; returns NULL while 
+         a producer has swapped the head but not yet linked its node
+Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *)
+Function Output/Parameters: updated interrupt queue (InterruptQueueType *)
+Function Output/Returned: oldest interrupt, NULL if none or a push is
+                          still completing (Interrupt *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: __atomic_load_n, pushInterruptQueue
+*/
+Interrupt *popInterruptQueue( InterruptQueueType *queuePtr )
+   {
+    // initialize function/variables
+    Interrupt *tailPtr = queuePtr->tail;
+    Interrupt *nextPtr = __atomic_load_n( &tailPtr->next, __ATOMIC_ACQUIRE );
+
+    // step past stub
+    if( tailPtr == &queuePtr->stub )
+       {
+        if( nextPtr == NULL )
+           {
+            return NULL;
+           }
+
+        queuePtr->tail = nextPtr;
+        tailPtr = nextPtr;
+        nextPtr = __atomic_load_n( &tailPtr->next, __ATOMIC_ACQUIRE );
+       }
+
+    // check for a node behind the tail, take the tail
+    if( nextPtr != NULL )
+       {
+        queuePtr->tail = nextPtr;
+
+        return tailPtr;
+       }
+
+    // check for a push still completing
+       // function: __atomic_load_n
+    if( tailPtr != __atomic_load_n( &queuePtr->head, __ATOMIC_ACQUIRE ) )
+       {
+        return NULL;
+       }
+
+    // last node, queue stub behind it, then take it
+       // function: pushInterruptQueue
+    pushInterruptQueue( queuePtr, &queuePtr->stub );
+
+    nextPtr = __atomic_load_n( &tailPtr->next, __ATOMIC_ACQUIRE );
+
+    if( nextPtr != NULL )
+       {
+        queuePtr->tail = nextPtr;
+
+        return tailPtr;
+       }
+
+    return NULL;
+   }
+
+/*
+Name: popReadyQueue
+Process: removes the next process to dispatch from the ready queue
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: next PCB, NULL if empty (PCBType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: peekReadyQueue, removeReadyQueue
+*/
+PCBType *popReadyQueue( ReadyQueueType *queuePtr )
+   {
+    PCBType *topPtr = peekReadyQueue( queuePtr );
+
+    if( topPtr != NULL )
+       {
+        removeReadyQueue( queuePtr, topPtr );
+       }
+
+    return topPtr;
+   }
+
+/*
+Name: pushInterruptQueue
+Process: adds an interrupt; swaps it in as the head, then links the 
+         previous head to it, so producers never wait on one another
+Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *),
+                           pointer to interrupt (Interrupt *)
+Function Output/Parameters: updated interrupt queue (InterruptQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: __atomic_store_n, __atomic_exchange_n
+*/
+void pushInterruptQueue( InterruptQueueType *queuePtr, Interrupt *intPtr )
+   {
+    Interrupt *prevPtr;
+
+    __atomic_store_n( &intPtr->next, NULL, __ATOMIC_RELAXED );
+
+    prevPtr = __atomic_exchange_n( &queuePtr->head, intPtr, __ATOMIC_ACQ_REL );
+
+    __atomic_store_n( &prevPtr->next, intPtr, __ATOMIC_RELEASE );
+   }
+
+/*
+Name: pushReadyQueue
+Process: keys a PCB by the queue policy and sifts it up from the end,
+         O(log n); for MLFQ, O(1) at its level tail; for CFS, inserted
+         in the tree, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: Boolean result, false if out of memory (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: appendReadyQueue, siftUpReadyQueue
+*/
+bool pushReadyQueue( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    // key PCB at the end, sift it up
+       // function: appendReadyQueue, siftUpReadyQueue
+    if( !appendReadyQueue( queuePtr, pcbPtr ) )
+       {
+        return false;
+       }
+
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE 
+                               || queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        return true;
+       }
+
+    siftUpReadyQueue( queuePtr, pcbPtr->queueIndex );
+
+    // return success
+    return true;
+   }
+
+/*
+Name: readyQueueBefore
+Process: heap order, policy key then queue order
+Function Input/Parameters: pointers to two PCBs (const PCBType *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result, true if first goes first (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+bool readyQueueBefore( const PCBType *onePtr, const PCBType *otherPtr )
+   {
+    return onePtr->queueKey < otherPtr->queueKey
+             || ( onePtr->queueKey == otherPtr->queueKey
+                                  && onePtr->queueOrder < otherPtr->queueOrder );
+   }
+
+/*
+Name: removeReadyQueue
+Process: removes a queued PCB from its heap position, the last entry
+         fills the gap and sifts whichever way restores order, O(log n);
+         for MLFQ, unlinks it from its level, O(1); for CFS, from the 
+         tree, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to queued PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: unlinkLevelPCB, unlinkTreePCB, siftUpReadyQueue, 
+              siftDownReadyQueue
+*/
+void removeReadyQueue( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    // initialize function/variables
+    int index = pcbPtr->queueIndex;
+    PCBType *movePtr;
+
+    // check for MLFQ, unlink if queued
+       // function: unlinkLevelPCB
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        if( index != NO_QUEUE_INDEX )
+           {
+            unlinkLevelPCB( queuePtr, pcbPtr );
+           }
+
+        return;
+       }
+
+    // check for CFS, unlink if queued
+       // function: unlinkTreePCB
+    if( queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        if( index != NO_QUEUE_INDEX )
+           {
+            unlinkTreePCB( queuePtr, pcbPtr );
+           }
+
+        return;
+       }
+
+    // check for not queued
+    if( index < 0 || index >= queuePtr->count 
+                                       || queuePtr->heap[ index ] != pcbPtr )
+       {
+        return;
+       }
+
+    // take out PCB, move last entry into its place
+    queuePtr->count--;
+    pcbPtr->queueIndex = NO_QUEUE_INDEX;
+
+    if( index < queuePtr->count )
+       {
+        movePtr = queuePtr->heap[ queuePtr->count ];
+        queuePtr->heap[ index ] = movePtr;
+        movePtr->queueIndex = index;
+
+        // restore order around moved entry
+           // function: siftUpReadyQueue, siftDownReadyQueue
+        siftUpReadyQueue( queuePtr, index );
+        siftDownReadyQueue( queuePtr, movePtr->queueIndex );
+       }
+   }
+
+/*
+Name: requeueReadyQueue
+Process: re-keys a queued PCB in place after it ran, a decrease-key for 
+         time remaining policies and an increase-key for queue order 
+         policies, then sifts it into position, O(log n); for MLFQ, 
+         where it is only called after a full quantum, moves the PCB to
+         the tail of the next level down, the lowest level keeping it, 
+         O(1); for CFS, reinserts it on the virtual runtime it has 
+         reached, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to queued PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: levelReadyPCB, unlinkLevelPCB, keyReadyPCB, linkLevelPCB,
+              unlinkTreePCB, linkTreePCB, siftUpReadyQueue, 
+              siftDownReadyQueue
+*/
+void requeueReadyQueue( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    int level;
+
+    // check for MLFQ, demote to next level tail
+       // function: levelReadyPCB, unlinkLevelPCB, keyReadyPCB, linkLevelPCB
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        level = levelReadyPCB( queuePtr, pcbPtr );
+
+        unlinkLevelPCB( queuePtr, pcbPtr );
+
+        if( level < queuePtr->levelCount - 1 )
+           {
+            pcbPtr->queueLevel = level + 1;
+           }
+
+        keyReadyPCB( queuePtr, pcbPtr );
+        linkLevelPCB( queuePtr, pcbPtr );
+
+        return;
+       }
+
+    // check for CFS, reinsert on new virtual runtime
+       // function: unlinkTreePCB, keyReadyPCB, linkTreePCB
+    if( queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        unlinkTreePCB( queuePtr, pcbPtr );
+        keyReadyPCB( queuePtr, pcbPtr );
+        linkTreePCB( queuePtr, pcbPtr );
+
+        return;
+       }
+
+    // set new key, sift whichever way it moved
+       // function: keyReadyPCB, siftUpReadyQueue, siftDownReadyQueue
+    keyReadyPCB( queuePtr, pcbPtr );
+
+    siftUpReadyQueue( queuePtr, pcbPtr->queueIndex );
+    siftDownReadyQueue( queuePtr, pcbPtr->queueIndex );
+   }
+
+/*
+Name: rotateTreeLeft
+Process: rotates a CFS tree node down to the left of its right child, 
+         which takes its place; order is unchanged
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB with a right child (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: moveTreePCB
+*/
+void rotateTreeLeft( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    PCBType *childPtr = pcbPtr->treeRight;
+
+    pcbPtr->treeRight = childPtr->treeLeft;
+
+    if( childPtr->treeLeft != NULL )
+       {
+        childPtr->treeLeft->treeParent = pcbPtr;
+       }
+
+    moveTreePCB( queuePtr, pcbPtr, childPtr );
+
+    childPtr->treeLeft = pcbPtr;
+    pcbPtr->treeParent = childPtr;
+   }
+
+/*
+Name: rotateTreeRight
+Process: rotates a CFS tree node down to the right of its left child, 
+         which takes its place; order is unchanged
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to PCB with a left child (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: moveTreePCB
+*/
+void rotateTreeRight( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    PCBType *childPtr = pcbPtr->treeLeft;
+
+    pcbPtr->treeLeft = childPtr->treeRight;
+
+    if( childPtr->treeRight != NULL )
+       {
+        childPtr->treeRight->treeParent = pcbPtr;
+       }
+
+    moveTreePCB( queuePtr, pcbPtr, childPtr );
+
+    childPtr->treeRight = pcbPtr;
+    pcbPtr->treeParent = childPtr;
+   }
+
+/*
+Name: stealReadyQueue
+Process: removes the last heap entry for another queue to run; it is a
+         leaf, so nothing moves, and never the root, which may be 
+         running, while two or more are queued, O(1); for MLFQ, the 
+         tail of the lowest non-empty level, never the running head of 
+         the highest, O(1); for CFS, the rightmost node, furthest from
+         the running leftmost, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: stolen PCB, NULL if under two queued (PCBType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: __builtin_clz, unlinkLevelPCB, unlinkTreePCB
+*/
+PCBType *stealReadyQueue( ReadyQueueType *queuePtr )
+   {
+    PCBType *stolenPtr;
+
+    // check for nothing but the root
+    if( queuePtr->count < 2 )
+       {
+        return NULL;
+       }
+
+    // check for MLFQ, take lowest level tail, highest set bit
+       // function: __builtin_clz, unlinkLevelPCB
+    if( queuePtr->schedCode == CPU_SCHED_MLFQ_CODE )
+       {
+        stolenPtr = queuePtr->levelTail[ 
+                                   31 - __builtin_clz( queuePtr->levelMap ) ];
+
+        unlinkLevelPCB( queuePtr, stolenPtr );
+
+        return stolenPtr;
+       }
+
+    // check for CFS, take rightmost node
+       // function: unlinkTreePCB
+    if( queuePtr->schedCode == CPU_SCHED_CFS_CODE )
+       {
+        stolenPtr = queuePtr->treeRoot;
+
+        while( stolenPtr->treeRight != NULL )
+           {
+            stolenPtr = stolenPtr->treeRight;
+           }
+
+        unlinkTreePCB( queuePtr, stolenPtr );
+
+        return stolenPtr;
+       }
+
+    queuePtr->count--;
+    stolenPtr = queuePtr->heap[ queuePtr->count ];
+    stolenPtr->queueIndex = NO_QUEUE_INDEX;
+
+    return stolenPtr;
+   }
+
+/*
+Name: siftDownReadyQueue
+Process: moves a heap entry down past each child that goes first
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           heap position (int)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: readyQueueBefore
+*/
+void siftDownReadyQueue( ReadyQueueType *queuePtr, int index )
+   {
+    // initialize function/variables
+    PCBType **heap = queuePtr->heap;
+    PCBType *movePtr = heap[ index ];
+    int child = 2 * index + 1;
+
+    // loop while a child goes first
+       // function: readyQueueBefore
+    while( child < queuePtr->count )
+       {
+        if( child + 1 < queuePtr->count
+                     && readyQueueBefore( heap[ child + 1 ], heap[ child ] ) )
+           {
+            child++;
+           }
+
+        if( !readyQueueBefore( heap[ child ], movePtr ) )
+           {
+            break;
+           }
+
+        heap[ index ] = heap[ child ];
+        heap[ index ]->queueIndex = index;
+        index = child;
+        child = 2 * index + 1;
+       }
+
+    heap[ index ] = movePtr;
+    movePtr->queueIndex = index;
+   }
+
+/*
+Name: siftUpReadyQueue
+Process: moves a heap entry up past each parent it goes before
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           heap position (int)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: readyQueueBefore
+*/
+void siftUpReadyQueue( ReadyQueueType *queuePtr, int index )
+   {
+    // initialize function/variables
+    PCBType **heap = queuePtr->heap;
+    PCBType *movePtr = heap[ index ];
+    int parent;
+
+    // loop while moved entry goes before its parent
+       // function: readyQueueBefore
+    while( index > 0 )
+       {
+        parent = ( index - 1 ) / 2;
+
+        if( !readyQueueBefore( movePtr, heap[ parent ] ) )
+           {
+            break;
+           }
+
+        heap[ index ] = heap[ parent ];
+        heap[ index ]->queueIndex = index;
+        index = parent;
+       }
+
+    heap[ index ] = movePtr;
+    movePtr->queueIndex = index;
+   }
+
+/*
+Name: unlinkLevelPCB
+Process: takes a PCB out of its MLFQ level list, clearing the level bit
+         when the list empties, O(1)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to queued PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: levelReadyPCB
+*/
+void unlinkLevelPCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    int level = levelReadyPCB( queuePtr, pcbPtr );
+
+    if( pcbPtr->prevReady == NULL )
+       {
+        queuePtr->levelHead[ level ] = pcbPtr->nextReady;
+       }
+    else
+       {
+        pcbPtr->prevReady->nextReady = pcbPtr->nextReady;
+       }
+
+    if( pcbPtr->nextReady == NULL )
+       {
+        queuePtr->levelTail[ level ] = pcbPtr->prevReady;
+       }
+    else
+       {
+        pcbPtr->nextReady->prevReady = pcbPtr->prevReady;
+       }
+
+    if( queuePtr->levelHead[ level ] == NULL )
+       {
+        queuePtr->levelMap &= ~( 1u << level );
+       }
+
+    pcbPtr->prevReady = NULL;
+    pcbPtr->nextReady = NULL;
+    pcbPtr->queueIndex = NO_QUEUE_INDEX;
+    queuePtr->count--;
+   }
+
+/*
+Name: unlinkTreePCB
+Process: removes a PCB from the CFS red-black tree; a node with two 
+         children is replaced by its successor; if a black node left 
+         its place, recolors and rotates up from there until black 
+         heights match; the cached leftmost moves to the successor and
+         the virtual runtime floor rises to its key, O(log n)
+Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                           pointer to queued PCB (PCBType *)
+Function Output/Parameters: updated ready queue (ReadyQueueType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: moveTreePCB, rotateTreeLeft, rotateTreeRight
+*/
+void unlinkTreePCB( ReadyQueueType *queuePtr, PCBType *pcbPtr )
+   {
+    PCBType *nodePtr, *parentPtr, *nextPtr, *siblingPtr;
+    bool blackFlag = !pcbPtr->treeRed;
+
+    // check for leftmost, advance cache to successor, it has no left
+    if( queuePtr->treeLeftmost == pcbPtr )
+       {
+        nextPtr = pcbPtr->treeRight;
+
+        if( nextPtr == NULL )
+           {
+            queuePtr->treeLeftmost = pcbPtr->treeParent;
+           }
+        else
+           {
+            while( nextPtr->treeLeft != NULL )
+               {
+                nextPtr = nextPtr->treeLeft;
+               }
+
+            queuePtr->treeLeftmost = nextPtr;
+           }
+       }
+
+    // splice out node with at most one child
+       // function: moveTreePCB
+    if( pcbPtr->treeLeft == NULL )
+       {
+        nodePtr = pcbPtr->treeRight;
+        parentPtr = pcbPtr->treeParent;
+        moveTreePCB( queuePtr, pcbPtr, nodePtr );
+       }
+    else if( pcbPtr->treeRight == NULL )
+       {
+        nodePtr = pcbPtr->treeLeft;
+        parentPtr = pcbPtr->treeParent;
+        moveTreePCB( queuePtr, pcbPtr, nodePtr );
+       }
+
+    // otherwise, move successor into its place and color
+    else
+       {
+        nextPtr = pcbPtr->treeRight;
+
+        while( nextPtr->treeLeft != NULL )
+           {
+            nextPtr = nextPtr->treeLeft;
+           }
+
+        blackFlag = !nextPtr->treeRed;
+        nodePtr = nextPtr->treeRight;
+
+        if( nextPtr->treeParent == pcbPtr )
+           {
+            parentPtr = nextPtr;
+           }
+        else
+           {
+            parentPtr = nextPtr->treeParent;
+            moveTreePCB( queuePtr, nextPtr, nodePtr );
+            nextPtr->treeRight = pcbPtr->treeRight;
+            nextPtr->treeRight->treeParent = nextPtr;
+           }
+
+        moveTreePCB( queuePtr, pcbPtr, nextPtr );
+        nextPtr->treeLeft = pcbPtr->treeLeft;
+        nextPtr->treeLeft->treeParent = nextPtr;
+        nextPtr->treeRed = pcbPtr->treeRed;
+       }
+
+    pcbPtr->treeParent = NULL;
+    pcbPtr->treeLeft = NULL;
+    pcbPtr->treeRight = NULL;
+    pcbPtr->queueIndex = NO_QUEUE_INDEX;
+    queuePtr->count--;
+
+    // check for black removed, fix the short side up the tree
+       // function: rotateTreeLeft, rotateTreeRight
+    while( blackFlag && nodePtr != queuePtr->treeRoot 
+                               && ( nodePtr == NULL || !nodePtr->treeRed ) )
+       {
+        if( nodePtr == parentPtr->treeLeft )
+           {
+            siblingPtr = parentPtr->treeRight;
+
+            // check for red sibling, rotate it over parent
+            if( siblingPtr->treeRed )
+               {
+                siblingPtr->treeRed = false;
+                parentPtr->treeRed = true;
+                rotateTreeLeft( queuePtr, parentPtr );
+                siblingPtr = parentPtr->treeRight;
+               }
+
+            // check for black nephews, move short side up
+            if( ( siblingPtr->treeLeft == NULL 
+                                     || !siblingPtr->treeLeft->treeRed )
+                   && ( siblingPtr->treeRight == NULL 
+                                     || !siblingPtr->treeRight->treeRed ) )
+               {
+                siblingPtr->treeRed = true;
+                nodePtr = parentPtr;
+                parentPtr = nodePtr->treeParent;
+               }
+
+            // otherwise, rotate red nephew over, done
+            else
+               {
+                if( siblingPtr->treeRight == NULL 
+                                         || !siblingPtr->treeRight->treeRed )
+                   {
+                    siblingPtr->treeLeft->treeRed = false;
+                    siblingPtr->treeRed = true;
+                    rotateTreeRight( queuePtr, siblingPtr );
+                    siblingPtr = parentPtr->treeRight;
+                   }
+
+                siblingPtr->treeRed = parentPtr->treeRed;
+                parentPtr->treeRed = false;
+                siblingPtr->treeRight->treeRed = false;
+                rotateTreeLeft( queuePtr, parentPtr );
+                nodePtr = queuePtr->treeRoot;
+               }
+           }
+        else
+           {
+            siblingPtr = parentPtr->treeLeft;
+
+            if( siblingPtr->treeRed )
+               {
+                siblingPtr->treeRed = false;
+                parentPtr->treeRed = true;
+                rotateTreeRight( queuePtr, parentPtr );
+                siblingPtr = parentPtr->treeLeft;
+               }
+
+            if( ( siblingPtr->treeLeft == NULL 
+                                     || !siblingPtr->treeLeft->treeRed )
+                   && ( siblingPtr->treeRight == NULL 
+                                     || !siblingPtr->treeRight->treeRed ) )
+               {
+                siblingPtr->treeRed = true;
+                nodePtr = parentPtr;
+                parentPtr = nodePtr->treeParent;
+               }
+            else
+               {
+                if( siblingPtr->treeLeft == NULL 
+                                          || !siblingPtr->treeLeft->treeRed )
+                   {
+                    siblingPtr->treeRight->treeRed = false;
+                    siblingPtr->treeRed = true;
+                    rotateTreeLeft( queuePtr, siblingPtr );
+                    siblingPtr = parentPtr->treeLeft;
+                   }
+
+                siblingPtr->treeRed = parentPtr->treeRed;
+                parentPtr->treeRed = false;
+                siblingPtr->treeLeft->treeRed = false;
+                rotateTreeRight( queuePtr, parentPtr );
+                nodePtr = queuePtr->treeRoot;
+               }
+           }
+       }
+
+    if( nodePtr != NULL )
+       {
+        nodePtr->treeRed = false;
+       }
+
+    // raise floor to new leftmost
+    if( queuePtr->treeLeftmost != NULL 
+                 && queuePtr->treeLeftmost->queueKey > queuePtr->minVruntime )
+       {
+        queuePtr->minVruntime = queuePtr->treeLeftmost->queueKey;
+       }
+   }
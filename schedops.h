@@ -0,0 +1,355 @@
+// protect from multiple compiling
+#ifndef SCHED_OPS_H
+#define SCHED_OPS_H
+
+// header files
+#include "configops.h"
+#include "StandardConstants.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+// constants
+
+typedef enum { READY_QUEUE_MIN_CAPACITY = 64,
+               NO_QUEUE_INDEX = -1 } SchedConstants;
+
+// ready processes as a binary min-heap on the policy key, then the
+// order the process was queued in; the PCB holds both values and its
+// heap position, so a queued PCB can be re-keyed or removed in place;
+// MLFQ instead keeps a FIFO list per level, linked through the PCBs, 
+// and a bitmap of non-empty levels, bit 0 the highest, so every queue
+// operation is O(1); a boost moves all lists to level 0 and starts a
+// new epoch, a PCB whose level is from an older epoch is at level 0;
+// CFS keeps a red-black tree on virtual runtime, linked through the 
+// PCBs, with its leftmost node cached for an O(1) pick, and a floor 
+// that queued virtual runtimes never fall below, so a new or woken 
+// process cannot starve the others with a small one
+typedef struct ReadyQueueType
+{
+    struct PCBType **heap;
+    int count;
+    int capacity;
+    int schedCode;
+    long long queueCounter;
+    struct PCBType *levelHead[ MLFQ_MAX_LEVELS ];
+    struct PCBType *levelTail[ MLFQ_MAX_LEVELS ];
+    unsigned int levelMap;
+    int levelCount;
+    int boostEpoch;
+    struct PCBType *treeRoot;
+    struct PCBType *treeLeftmost;
+    long long minVruntime;
+} ReadyQueueType;
+
+// I/O completion interrupt, one node embedded in each PCB
+typedef struct Interrupt
+{
+    struct PCBType *pcbPtr;
+    struct Interrupt *next;
+} Interrupt;
+
+// interrupts as an intrusive lock-free multi-producer, single-consumer
+// queue: device threads push with one atomic exchange, the consumer 
+// pops without atomics past the stub node; producers never wait on a
+// lock or on each other
+typedef struct InterruptQueueType
+{
+    Interrupt *head;
+    Interrupt *tail;
+    Interrupt stub;
+} InterruptQueueType;
+
+// Function prototypes
+
+/*
+ Name: appendReadyQueue
+ Process: keys a PCB and adds it at the heap end without sifting, for
+          a bulk build finished by heapifyReadyQueue
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: Boolean result, false if out of memory (bool)
+ */
+bool appendReadyQueue( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: boostReadyQueue
+ Process: MLFQ priority boost, moves every level list to the end of 
+          level 0 in level order and starts a new epoch, O(levels)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void boostReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: clearReadyQueue
+ Process: releases the ready queue heap, queued PCBs are not released
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: cleared ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void clearReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: growReadyQueue
+ Process: makes room for a number of queued PCBs, growing by doubling
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            number of PCBs to hold (int)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: Boolean result, false if out of memory (bool)
+ */
+bool growReadyQueue( ReadyQueueType *queuePtr, int needCount );
+
+/*
+ Name: heapifyReadyQueue
+ Process: restores heap order over appended PCBs bottom up, O(n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void heapifyReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: initInterruptQueue
+ Process: sets up an empty interrupt queue on its stub node
+ Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *)
+ Function Output/Parameters: empty interrupt queue (InterruptQueueType *)
+ Function Output/Returned: none
+ */
+void initInterruptQueue( InterruptQueueType *queuePtr );
+
+/*
+ Name: initReadyQueue
+ Process: sets up an empty ready queue ordered for a scheduling policy
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            cpu scheduling code (int),
+                            MLFQ level count (int)
+ Function Output/Parameters: empty ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void initReadyQueue( ReadyQueueType *queuePtr, int schedCode, 
+                                                           int levelCount );
+
+/*
+ Name: isPreemptivePolicy
+ Process: reports whether a scheduling policy preempts on quantum expiry
+ Function Input/Parameters: cpu scheduling code (int)
+ Function Output/Parameters: none
+ Function Output/Returned: Boolean result, true for _P policies (bool)
+ */
+bool isPreemptivePolicy( int schedCode );
+
+/*
+ Name: keyReadyPCB
+ Process: sets the policy key and queue order of a PCB
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: keyed PCB (struct PCBType *)
+ Function Output/Returned: none
+ */
+void keyReadyPCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: levelReadyPCB
+ Process: reports the MLFQ level of a PCB, first moving it to level 0
+          if it was set before the last boost
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: current PCB level (struct PCBType *)
+ Function Output/Returned: level, 0 the highest (int)
+ */
+int levelReadyPCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: linkTreePCB
+ Process: inserts a keyed PCB into the CFS tree and rebalances it, 
+          keeping the leftmost node cached, O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void linkTreePCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: linkLevelPCB
+ Process: adds a PCB at the tail of its MLFQ level list, O(1)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void linkLevelPCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: moveTreePCB
+ Process: puts one CFS tree node in place of another under its parent
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to replaced PCB (struct PCBType *),
+                            pointer to replacing PCB, may be NULL 
+                            (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void moveTreePCB( ReadyQueueType *queuePtr, struct PCBType *oldPtr, 
+                                                struct PCBType *newPtr );
+
+/*
+ Name: peekReadyQueue
+ Process: reports the next process to dispatch, leaving it queued
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: none
+ Function Output/Returned: next PCB, NULL if empty (struct PCBType *)
+ */
+struct PCBType *peekReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: popInterruptQueue
+ Process: removes the oldest interrupt, consumer only, wait free
+ Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *)
+ Function Output/Parameters: updated interrupt queue (InterruptQueueType *)
+ Function Output/Returned: oldest interrupt, NULL if none or a push is
+                           still completing (Interrupt *)
+ */
+Interrupt *popInterruptQueue( InterruptQueueType *queuePtr );
+
+/*
+ Name: popReadyQueue
+ Process: removes the next process to dispatch from the ready queue
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: next PCB, NULL if empty (struct PCBType *)
+ */
+struct PCBType *popReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: pushInterruptQueue
+ Process: adds an interrupt, any number of producers, lock free
+ Function Input/Parameters: pointer to interrupt queue (InterruptQueueType *),
+                            pointer to interrupt (Interrupt *)
+ Function Output/Parameters: updated interrupt queue (InterruptQueueType *)
+ Function Output/Returned: none
+ */
+void pushInterruptQueue( InterruptQueueType *queuePtr, Interrupt *intPtr );
+
+/*
+ Name: pushReadyQueue
+ Process: keys a PCB by the queue policy and adds it to the ready queue,
+          O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: Boolean result, false if out of memory (bool)
+ */
+bool pushReadyQueue( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: readyQueueBefore
+ Process: heap order, policy key then queue order
+ Function Input/Parameters: pointers to two PCBs (const struct PCBType *)
+ Function Output/Parameters: none
+ Function Output/Returned: Boolean result, true if first goes first (bool)
+ */
+bool readyQueueBefore( const struct PCBType *onePtr,
+                                              const struct PCBType *otherPtr );
+
+/*
+ Name: removeReadyQueue
+ Process: removes a queued PCB from its heap position, O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to queued PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void removeReadyQueue( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: requeueReadyQueue
+ Process: re-keys a queued PCB in place after it ran, decrease-key for
+          time remaining policies, increase-key for queue order, O(log n);
+          for MLFQ, after a full quantum, moves it one level down, O(1);
+          for CFS, reinserts it on its new virtual runtime, O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to queued PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void requeueReadyQueue( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: rotateTreeLeft
+ Process: rotates a CFS tree node down to the left of its right child
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void rotateTreeLeft( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: rotateTreeRight
+ Process: rotates a CFS tree node down to the right of its left child
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void rotateTreeRight( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: stealReadyQueue
+ Process: removes the last heap entry for another queue to run, a leaf
+          and never the root while two or more are queued, O(1); for 
+          MLFQ, the tail of the lowest non-empty level; for CFS, the 
+          rightmost node, O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: stolen PCB, NULL if under two queued
+                           (struct PCBType *)
+ */
+struct PCBType *stealReadyQueue( ReadyQueueType *queuePtr );
+
+/*
+ Name: siftDownReadyQueue
+ Process: moves a heap entry down past each child that goes first
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            heap position (int)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void siftDownReadyQueue( ReadyQueueType *queuePtr, int index );
+
+/*
+ Name: siftUpReadyQueue
+ Process: moves a heap entry up past each parent it goes before
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            heap position (int)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void siftUpReadyQueue( ReadyQueueType *queuePtr, int index );
+
+/*
+ Name: unlinkLevelPCB
+ Process: takes a PCB out of its MLFQ level list, O(1)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to queued PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void unlinkLevelPCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+/*
+ Name: unlinkTreePCB
+ Process: removes a PCB from the CFS tree and rebalances it, advancing
+          the cached leftmost node and the virtual runtime floor, 
+          O(log n)
+ Function Input/Parameters: pointer to ready queue (ReadyQueueType *),
+                            pointer to queued PCB (struct PCBType *)
+ Function Output/Parameters: updated ready queue (ReadyQueueType *)
+ Function Output/Returned: none
+ */
+void unlinkTreePCB( ReadyQueueType *queuePtr, struct PCBType *pcbPtr );
+
+#endif // SCHED_OPS_H
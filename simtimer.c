@@ -21,113 +21,526 @@
 #ifndef SIMTIMER_C
 #define SIMTIMER_C
 
+// POSIX monotonic clock and absolute sleep
+#define _POSIX_C_SOURCE 200809L
+
 // Header files ///////////////////////////////////////////////////////////////
 
 #include "simtimer.h"
+#include <errno.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
 
 // Constants  /////////////////////////////////////////////////////////////////
 
 const char RADIX_POINT = '.';
 
-void runTimer( int milliSeconds )
+// cleared for no-wait runs, op times are then not waited out
+static bool timerWaitFlag = true;
+
+// final busy-wait before the deadline, zero sleeps the whole wait
+static long timerSpinNSec = 0;
+
+/* Timer context: each simulation run creates its own timer and binds
+   it to its threads, so the wrappers below reach the right timer from
+   any thread; threads with no bound timer share the default one
+*/
+static SimTimerType defaultTimer = { PTHREAD_MUTEX_INITIALIZER, false, 
+                                  0, 0, 1.0, false, 0, 0, 0, NULL, 0, 0 };
+static pthread_key_t currentTimerKey;
+static pthread_key_t timerRankKey;
+static pthread_once_t currentTimerOnce = PTHREAD_ONCE_INIT;
+
+static void makeCurrentTimerKey()
+   {
+    pthread_key_create( &currentTimerKey, NULL );
+    pthread_key_create( &timerRankKey, NULL );
+   }
+
+SimTimerType *createSimTimer()
+   {
+    SimTimerType *timerPtr = (SimTimerType *)malloc( sizeof( SimTimerType ) );
+
+    if( timerPtr != NULL )
+       {
+        pthread_mutex_init( &timerPtr->timerMutex, NULL );
+        timerPtr->runningFlag = false;
+        timerPtr->startNSec = 0;
+        timerPtr->stopNSec = 0;
+        timerPtr->timeScale = 1.0;
+        timerPtr->virtualFlag = false;
+        timerPtr->virtualNowNSec = 0;
+        timerPtr->virtualArrivals = 0;
+        timerPtr->virtualRunning = 0;
+        timerPtr->virtualHeap = NULL;
+        timerPtr->virtualCount = 0;
+        timerPtr->virtualCapacity = 0;
+       }
+
+    return timerPtr;
+   }
+
+SimTimerType *clearSimTimer( SimTimerType *timerPtr )
+   {
+    if( timerPtr != NULL && timerPtr != &defaultTimer )
+       {
+        pthread_mutex_destroy( &timerPtr->timerMutex );
+        free( timerPtr->virtualHeap );
+        free( timerPtr );
+       }
+
+    return NULL;
+   }
+
+void bindSimTimer( SimTimerType *timerPtr )
+   {
+    pthread_once( &currentTimerOnce, makeCurrentTimerKey );
+
+    pthread_setspecific( currentTimerKey, timerPtr );
+   }
+
+SimTimerType *currentSimTimer()
+   {
+    SimTimerType *timerPtr;
+
+    pthread_once( &currentTimerOnce, makeCurrentTimerKey );
+
+    timerPtr = (SimTimerType *)pthread_getspecific( currentTimerKey );
+
+    if( timerPtr == NULL )
+       {
+        timerPtr = &defaultTimer;
+       }
+
+    return timerPtr;
+   }
+
+long long monotonicNSec()
+   {
+    struct timespec nowTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &nowTime );
+
+    return (long long)nowTime.tv_sec * 1000000000LL + nowTime.tv_nsec;
+   }
+
+// called with timerMutex held
+long long nowSimTimer( SimTimerType *timerPtr )
+   {
+    if( timerPtr->virtualFlag )
+       {
+        return timerPtr->virtualNowNSec;
+       }
+
+    return monotonicNSec();
+   }
+
+/* Called with timerMutex held; real time elapsed is scaled by the time
+   scale so a run with waits shortened by the factor reports simulated
+   times
+*/
+static long long elapsedSimTimer( SimTimerType *timerPtr, long long nowNSec )
+   {
+    if( timerPtr->virtualFlag )
+       {
+        return nowNSec - timerPtr->startNSec;
+       }
+
+    return (long long)( ( nowNSec - timerPtr->startNSec ) 
+                                                      * timerPtr->timeScale );
+   }
+
+long long zeroSimTimer( SimTimerType *timerPtr )
+   {
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    timerPtr->virtualNowNSec = 0;
+    timerPtr->startNSec = nowSimTimer( timerPtr );
+    timerPtr->runningFlag = true;
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+
+    return 0;
+   }
+
+long long lapSimTimer( SimTimerType *timerPtr )
+   {
+    long long lapNSec = 0;
+
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    if( timerPtr->runningFlag )
+       {
+        lapNSec = elapsedSimTimer( timerPtr, nowSimTimer( timerPtr ) );
+       }
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+
+    return lapNSec;
+   }
+
+long long stopSimTimer( SimTimerType *timerPtr )
+   {
+    long long lapNSec = 0;
+
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    if( timerPtr->runningFlag )
+       {
+        timerPtr->stopNSec = nowSimTimer( timerPtr );
+        timerPtr->runningFlag = false;
+
+        lapNSec = elapsedSimTimer( timerPtr, timerPtr->stopNSec );
+       }
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+
+    return lapNSec;
+   }
+
+void setSimTimerVirtual( SimTimerType *timerPtr, bool virtualFlag )
+   {
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    timerPtr->virtualFlag = virtualFlag;
+    timerPtr->virtualNowNSec = 0;
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+   }
+
+void setSimTimerScale( SimTimerType *timerPtr, double timeScale )
+   {
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    if( timeScale > 0.0 )
+       {
+        timerPtr->timeScale = timeScale;
+       }
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+   }
+
+/* Sleeps to an absolute CLOCK_MONOTONIC deadline so waiting threads
+   use no CPU and do not drift when a sleep is interrupted or late;
+   with a spin set, sleeps to just short of the deadline and spins
+   the rest for sub-100 microsecond precision; the wait is divided by
+   the time scale
+*/
+void runSimTimer( SimTimerType *timerPtr, int milliSeconds )
+   {
+    struct timespec deadline, sleepEnd, nowTime;
+    bool virtualFlag;
+    long long waitNSec;
+
+    if( !timerWaitFlag || milliSeconds <= 0 )
+       {
+        return;
+       }
+
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    virtualFlag = timerPtr->virtualFlag;
+    waitNSec = (long long)( milliSeconds * 1000000.0 / timerPtr->timeScale );
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+
+    if( virtualFlag )
+       {
+        runVirtualTimer( timerPtr, milliSeconds );
+        return;
+       }
+
+    clock_gettime( CLOCK_MONOTONIC, &deadline );
+
+    deadline.tv_sec += waitNSec / 1000000000LL;
+    deadline.tv_nsec += (long)( waitNSec % 1000000000LL );
+
+    if( deadline.tv_nsec >= 1000000000L )
+       {
+        deadline.tv_nsec -= 1000000000L;
+        deadline.tv_sec++;
+       }
+
+    sleepEnd = deadline;
+    sleepEnd.tv_nsec -= timerSpinNSec;
+
+    if( sleepEnd.tv_nsec < 0 )
+       {
+        sleepEnd.tv_nsec += 1000000000L;
+        sleepEnd.tv_sec--;
+       }
+
+    while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, 
+                                                &sleepEnd, NULL ) == EINTR )
+       {
+        // resume sleep to same deadline after signal
+       }
+
+    if( timerSpinNSec > 0 )
+       {
+        do
+           {
+            clock_gettime( CLOCK_MONOTONIC, &nowTime );
+           }
+        while( nowTime.tv_sec < deadline.tv_sec 
+                              || ( nowTime.tv_sec == deadline.tv_sec 
+                                      && nowTime.tv_nsec < deadline.tv_nsec ) );
+       }
+   }
+
+bool virtualWaitBefore( const VirtualWaitType *onePtr, 
+                                               const VirtualWaitType *otherPtr )
+   {
+    if( onePtr->wakeNSec != otherPtr->wakeNSec )
+       {
+        return onePtr->wakeNSec < otherPtr->wakeNSec;
+       }
+
+    if( onePtr->rank != otherPtr->rank )
+       {
+        return onePtr->rank < otherPtr->rank;
+       }
+
+    return onePtr->arrival < otherPtr->arrival;
+   }
+
+/* Virtual time: waits become wake events in a min-heap ordered by wake
+   time, then the waiting thread's rank, then arrival; when every 
+   registered simulation thread is waiting, the clock jumps to the 
+   earliest event and its thread resumes, so log times match real time
+   runs without any sleeping; ranked threads resume in the same order
+   however the host schedules them, so runs repeat exactly.
+   Called with timerMutex held
+*/
+void advanceVirtualTimer( SimTimerType *timerPtr )
    {
-    struct timeval startTime, endTime;
-    int startSec, startUSec, endSec, endUSec;
-    int uSecDiff, mSecDiff, secDiff, timeDiff;
+    VirtualWaitType **heap = timerPtr->virtualHeap;
+    VirtualWaitType *wakePtr, *movePtr;
+    int index = 0, child;
+
+    if( timerPtr->virtualRunning > 0 || timerPtr->virtualCount == 0 )
+       {
+        return;
+       }
+
+    wakePtr = heap[ 0 ];
+    timerPtr->virtualCount--;
+    movePtr = heap[ timerPtr->virtualCount ];
+
+    child = 1;
+
+    while( child < timerPtr->virtualCount )
+       {
+        if( child + 1 < timerPtr->virtualCount 
+               && virtualWaitBefore( heap[ child + 1 ], heap[ child ] ) )
+           {
+            child++;
+           }
+
+        if( !virtualWaitBefore( heap[ child ], movePtr ) )
+           {
+            break;
+           }
 
-    gettimeofday( &startTime, NULL );
- 
-    startSec = startTime.tv_sec;
-    startUSec = startTime.tv_usec;
+        heap[ index ] = heap[ child ];
+        index = child;
+        child = 2 * index + 1;
+       }
 
-    timeDiff = 0;
+    if( timerPtr->virtualCount > 0 )
+       {
+        heap[ index ] = movePtr;
+       }
 
-    while( timeDiff < milliSeconds )
+    if( wakePtr->wakeNSec > timerPtr->virtualNowNSec )
        {
-        gettimeofday( &endTime, NULL );
+        timerPtr->virtualNowNSec = wakePtr->wakeNSec;
+       }
+
+    wakePtr->readyFlag = true;
+    timerPtr->virtualRunning++;
+
+    pthread_cond_signal( &wakePtr->wakeCond );
+   }
+
+void addSimTimerThread( SimTimerType *timerPtr )
+   {
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    timerPtr->virtualRunning++;
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+   }
+
+void endSimTimerThread( SimTimerType *timerPtr )
+   {
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    timerPtr->virtualRunning--;
+
+    advanceVirtualTimer( timerPtr );
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+   }
 
-        endSec = endTime.tv_sec;
-        endUSec = endTime.tv_usec;
-        uSecDiff = endUSec - startUSec;
+void runVirtualTimer( SimTimerType *timerPtr, int milliSeconds )
+   {
+    VirtualWaitType waitData, **newHeap;
+    int index, parent, newCapacity;
+
+    pthread_mutex_lock( &timerPtr->timerMutex );
+
+    if( timerPtr->virtualCount == timerPtr->virtualCapacity )
+       {
+        newCapacity = timerPtr->virtualCapacity * 2 + 16;
+        newHeap = (VirtualWaitType **)realloc( timerPtr->virtualHeap, 
+                                    newCapacity * sizeof( VirtualWaitType * ) );
 
-        if( uSecDiff < 0 )
+        if( newHeap == NULL )
            {
-            uSecDiff = uSecDiff + 1000000;
+            timerPtr->virtualNowNSec += (long long)milliSeconds * 1000000LL;
+
+            pthread_mutex_unlock( &timerPtr->timerMutex );
+
+            return;
+           }
+
+        timerPtr->virtualHeap = newHeap;
+        timerPtr->virtualCapacity = newCapacity;
+       }
+
+    waitData.wakeNSec = timerPtr->virtualNowNSec 
+                                         + (long long)milliSeconds * 1000000LL;
+    waitData.rank = currentTimerRank();
+    waitData.arrival = timerPtr->virtualArrivals++;
+    waitData.readyFlag = false;
+    pthread_cond_init( &waitData.wakeCond, NULL );
+
+    index = timerPtr->virtualCount;
+    timerPtr->virtualCount++;
+
+    while( index > 0 )
+       {
+        parent = ( index - 1 ) / 2;
 
-            endSec = endSec - 1;
+        if( !virtualWaitBefore( &waitData, timerPtr->virtualHeap[ parent ] ) )
+           {
+            break;
            }
 
-        mSecDiff = uSecDiff / 1000;
-        secDiff = ( endSec - startSec ) * 1000;
-        timeDiff = secDiff + mSecDiff;
+        timerPtr->virtualHeap[ index ] = timerPtr->virtualHeap[ parent ];
+        index = parent;
+       }
+
+    timerPtr->virtualHeap[ index ] = &waitData;
+
+    timerPtr->virtualRunning--;
+
+    advanceVirtualTimer( timerPtr );
+
+    while( !waitData.readyFlag )
+       {
+        pthread_cond_wait( &waitData.wakeCond, &timerPtr->timerMutex );
        }
+
+    pthread_mutex_unlock( &timerPtr->timerMutex );
+
+    pthread_cond_destroy( &waitData.wakeCond );
    }
 
-double accessTimer( int controlCode, char *timeStr )
+void nSecToString( long long nSec, char *timeStr )
+   {
+    timeToString( (int)( nSec / 1000000000LL ), 
+                            (int)( nSec % 1000000000LL / 1000LL ), timeStr );
+   }
+
+void runTimer( int milliSeconds )
    {
-    static Boolean running = false;
-    static int startSec = 0, endSec = 0, startUSec = 0, endUSec = 0;
-    static int lapSec = 0, lapUSec = 0;
-    struct timeval startData, lapData, endData;
-    double fpTime = 0.0;
+    runSimTimer( currentSimTimer(), milliSeconds );
+   }
 
-    switch( controlCode )
+void setTimerSpin( int microSeconds )
+   {
+    if( microSeconds < 0 )
        {
-        case ZERO_TIMER:
-           gettimeofday( &startData, NULL );
-           running = true;
+        microSeconds = 0;
+       }
 
-           startSec = startData.tv_sec;
-           startUSec = startData.tv_usec;
+    else if( microSeconds > 999999 )
+       {
+        microSeconds = 999999;
+       }
 
-           fpTime = 0.000000000;
-           lapSec = 0.000000000;
-           lapUSec = 0.000000000;
+    timerSpinNSec = (long)microSeconds * 1000L;
+   }
 
-           timeToString( lapSec, lapUSec, timeStr ); 
-           break;
-           
-        case LAP_TIMER:
-           if( running == true )
-              {
-               gettimeofday( &lapData, NULL );
+void setTimerWait( bool waitFlag )
+   {
+    timerWaitFlag = waitFlag;
+   }
+
+void setVirtualTimer( bool virtualFlag )
+   {
+    setSimTimerVirtual( currentSimTimer(), virtualFlag );
+   }
+
+void setTimerScale( double timeScale )
+   {
+    setSimTimerScale( currentSimTimer(), timeScale );
+   }
+
+void addTimerThread()
+   {
+    addSimTimerThread( currentSimTimer() );
+   }
 
-               lapSec = lapData.tv_sec;
-               lapUSec = lapData.tv_usec;
+void endTimerThread()
+   {
+    endSimTimerThread( currentSimTimer() );
+   }
+
+/* Wake rank: a fixed order among threads whose virtual waits end at the
+   same time, set by each thread for itself; threads without one keep 
+   their arrival order
+*/
+void setTimerRank( int rank )
+   {
+    pthread_once( &currentTimerOnce, makeCurrentTimerKey );
+
+    pthread_setspecific( timerRankKey, (void *)(intptr_t)( rank + 1 ) );
+   }
+
+int currentTimerRank()
+   {
+    pthread_once( &currentTimerOnce, makeCurrentTimerKey );
+
+    return (int)(intptr_t)pthread_getspecific( timerRankKey ) - 1;
+   }
+
+double accessTimer( int controlCode, char *timeStr )
+   {
+    SimTimerType *timerPtr = currentSimTimer();
+    long long lapNSec = 0;
 
-               fpTime = processTime( startSec, lapSec, 
-                                                 startUSec, lapUSec, timeStr );
-              }
+    switch( controlCode )
+       {
+        case ZERO_TIMER:
+           lapNSec = zeroSimTimer( timerPtr );
+           break;
 
-           else
-              {
-               fpTime = 0.000000000;
-              }
+        case LAP_TIMER:
+           lapNSec = lapSimTimer( timerPtr );
            break;
 
         case STOP_TIMER:
-           if( running == true )
-              {
-               gettimeofday( &endData, NULL );
-               running = false;
-
-               endSec = endData.tv_sec;
-               endUSec = endData.tv_usec;
-
-               fpTime = processTime( startSec, endSec, 
-                                                 startUSec, endUSec, timeStr );
-              }
-
-           // assume timer not running
-           else
-              {
-               fpTime = 0.000000000;
-              }
+           lapNSec = stopSimTimer( timerPtr );
            break;
        }
 
-    return fpTime;
+    nSecToString( lapNSec, timeStr );
+
+    return (double)lapNSec / 1.0e9;
    }
 
 double processTime( double startSec, double endSec, 
@@ -151,77 +564,58 @@ double processTime( double startSec, double endSec,
    }
 
 
-/* This is a bit of a drawn-out function, but it is written
-   to force the time result to always be in the form x.xxxxxxx
-   when printed as a string; this will not always be the case
-   if the time is presented as a floating point number
+/* Forces the time result to always be in the form x.xxxxxx when printed
+   as a string; digits come two at a time from a pair table, written
+   front to back, so formatting is a handful of stores per time
 */
+static const char DIGIT_PAIRS[] =
+       "0001020304050607080910111213141516171819"
+       "2021222324252627282930313233343536373839"
+       "4041424344454647484950515253545556575859"
+       "6061626364656667686970717273747576777879"
+       "8081828384858687888990919293949596979899";
+
 void timeToString( int secTime, int uSecTime, char *timeStr )
    {
-    int low, high, index = 0;
-    char temp;
-
-    while( uSecTime > 0 )
-       {
-        timeStr[ index ] = (char) ( uSecTime % 10 + '0' );
-        uSecTime /= 10;
+    char secDigits[ MIN_STR_LEN ];
+    int index = 0, secIndex = 0;
 
-        index++;
-        
-       }
-
-    while( index < 6 )
+    if( secTime < 10 ) // single digit in display
        {
-        timeStr[ index ] = '0';
+        timeStr[ index ] = SPACE;
+        timeStr[ index + 1 ] = (char) ( secTime + '0' );
 
-        index++;
+        index += 2;
        }
 
-    timeStr[ index ] = RADIX_POINT;
-
-    index++;
-
-    if( secTime < 10 ) // single digit in display
+    else
        {
-        timeStr[ index ] = (char) ( secTime % 10 + '0' );
-
-        index++;
-
-        timeStr[ index ] = SPACE;
+        while( secTime > 0 )
+           {
+            secDigits[ secIndex ] = (char) ( secTime % 10 + '0' );
+            secTime /= 10;
 
-        index++;
+            secIndex++;
+           }
 
-        secTime = 0;
-       }
-/*
-    if( secTime == 0 )
-       {
-        timeStr[ index ] = '0';
-    
-        index++;
-       }
-*/
-    while( secTime > 0 )
-       {
-        timeStr[ index ] = (char) ( secTime % 10 + '0' );
+        while( secIndex > 0 )
+           {
+            secIndex--;
 
-        secTime /= 10;
+            timeStr[ index ] = secDigits[ secIndex ];
 
-        index++;
+            index++;
+           }
        }
 
-    timeStr[ index ] = NULL_CHAR;
-
-    low = 0; high = index - 1;
+    timeStr[ index ] = RADIX_POINT;
 
-    while( low < high )
-       {
-        temp = timeStr[ low ];
-        timeStr[ low ] = timeStr[ high ];
-        timeStr[ high ] = temp;
+    memcpy( &timeStr[ index + 1 ], &DIGIT_PAIRS[ uSecTime / 10000 * 2 ], 2 );
+    memcpy( &timeStr[ index + 3 ], 
+                              &DIGIT_PAIRS[ uSecTime / 100 % 100 * 2 ], 2 );
+    memcpy( &timeStr[ index + 5 ], &DIGIT_PAIRS[ uSecTime % 100 * 2 ], 2 );
 
-        low++; high--;
-       }
+    timeStr[ index + 7 ] = NULL_CHAR;
    }
 
 #endif // ifndef SIMTIMER_C
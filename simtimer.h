@@ -31,11 +31,73 @@
 
 enum TIMER_CTRL_CODES { ZERO_TIMER, LAP_TIMER, STOP_TIMER };
 
+// wake rank of a thread that never set one, ordered before all others
+enum TIMER_RANK_CODES { NO_TIMER_RANK = -1 };
+
 extern const char RADIX_POINT;
 
+// one waiting thread in virtual time, queued by wake time, then the
+// thread's wake rank, then arrival, which only orders unranked threads
+typedef struct VirtualWaitType
+   {
+    long long wakeNSec;
+    int rank;
+    long long arrival;
+    bool readyFlag;
+    pthread_cond_t wakeCond;
+   } VirtualWaitType;
+
+// per run timer context, all fields guarded by timerMutex; real time
+// is CLOCK_MONOTONIC nanoseconds times the time scale, virtual time is
+// the event clock
+typedef struct SimTimerType
+   {
+    pthread_mutex_t timerMutex;
+    bool runningFlag;
+    long long startNSec;
+    long long stopNSec;
+    double timeScale;
+    bool virtualFlag;
+    long long virtualNowNSec;
+    long long virtualArrivals;
+    int virtualRunning;
+    VirtualWaitType **virtualHeap;
+    int virtualCount;
+    int virtualCapacity;
+   } SimTimerType;
+
 // Function Prototyp  /////////////////////////////////////////////////////////
 
+SimTimerType *createSimTimer();
+SimTimerType *clearSimTimer( SimTimerType *timerPtr );
+void bindSimTimer( SimTimerType *timerPtr );
+SimTimerType *currentSimTimer();
+long long monotonicNSec();
+long long nowSimTimer( SimTimerType *timerPtr );
+long long zeroSimTimer( SimTimerType *timerPtr );
+long long lapSimTimer( SimTimerType *timerPtr );
+long long stopSimTimer( SimTimerType *timerPtr );
+void setSimTimerVirtual( SimTimerType *timerPtr, bool virtualFlag );
+void setSimTimerScale( SimTimerType *timerPtr, double timeScale );
+void runSimTimer( SimTimerType *timerPtr, int milliSeconds );
+void runVirtualTimer( SimTimerType *timerPtr, int milliSeconds );
+void advanceVirtualTimer( SimTimerType *timerPtr );
+bool virtualWaitBefore( const VirtualWaitType *onePtr, 
+                                              const VirtualWaitType *otherPtr );
+void addSimTimerThread( SimTimerType *timerPtr );
+void endSimTimerThread( SimTimerType *timerPtr );
+void nSecToString( long long nSec, char *timeStr );
+
+// wrappers over the timer bound to the calling thread
 void runTimer( int milliSeconds );
+void setTimerSpin( int microSeconds );
+void setTimerWait( bool waitFlag );
+void setVirtualTimer( bool virtualFlag );
+void setTimerScale( double timeScale );
+void addTimerThread();
+void endTimerThread();
+void setTimerRank( int rank );
+int currentTimerRank();
 double accessTimer( int controlCode, char *timeStr );
 double processTime( double startSec, double endSec, 
                            double startUSec, double endUSec, char *timeStr );
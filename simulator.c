@@ -1,4 +1,9 @@
+// POSIX support for online core count
+#define _POSIX_C_SOURCE 200809L
+
+// header files
 #include "simulator.h"
+#include <unistd.h>
 
 /*
 Name: runSim
@@ -22,9 +27,21 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
        
        // temp pointer for metadata looping
        OpCodeType *metaDataHolder = metaDataMstrPtr;
-        
-       // set PCBhead for data storage to NULL
-       PCBType *PCBHead = startPCB( metaDataHolder, configPtr );
+
+       // process index built at load time
+       ProcessIndexTable procIndex;
+
+    // decode ops and precompute op times before any simulation
+       // function: decodeMetaData
+    decodeMetaData( metaDataHolder, configPtr );
+
+    // index processes in one pass for PCB build and run time queries
+       // function: buildProcessIndex
+    buildProcessIndex( metaDataHolder, &procIndex );
+
+    // initialize simulation variables
+       // set PCBhead for data storage
+       PCBType *PCBHead = startPCB( &procIndex, configPtr );
         
        // set temp PCB head for looping to NULL
        PCBType *PCBHeadHolder = NULL;
@@ -34,249 +51,2094 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
     
        // Variable for logging to file at end
        logToFile *fileHolder = (logToFile *)malloc(sizeof(logToFile));
+
+       // used memory list
+       memHolder *usedMem = NULL;
+
+       // run state shared by cpu dispatchers and worker pool
+       SimRunType simRun;
         
         
+    // open log file, check for failure, log to monitor instead
+       // function: fopen, printf
     if(logCode == LOGTO_BOTH_CODE || logCode == LOGTO_FILE_CODE)
        {
         logFile = fopen( configPtr->logToFileName, "w" );
+
+        if( logFile == NULL )
+           {
+            printf( "\nLog File Access Error: %s, logging to monitor\n\n",
+                                                    configPtr->logToFileName );
+
+            logCode = LOGTO_MONITOR_CODE;
+            configPtr->logToCode = LOGTO_MONITOR_CODE;
+           }
        }
 
       // variable that holds timer data
       char timer[STD_STR_LEN];
-      char fileLine[STD_STR_LEN];
-    
+
+      // timer for this run, bound to this thread and worker pool
+      SimTimerType *simTimer = createSimTimer();
     
+   // set empty first log line
+   fileHolder->filePiece[ 0 ] = NULL_CHAR;
+   fileHolder->next = NULL;
+   fileHolder->tail = fileHolder;
+   fileHolder->eventNSec = NO_EVENT_TIME;
+
+   // select real or virtual time and time scale, start timer
+      // function: bindSimTimer, setVirtualTimer, setTimerScale, 
+      //           accessTimer
+   bindSimTimer( simTimer );
+   setVirtualTimer( configPtr->timeModeCode == TIME_VIRTUAL_CODE );
+   setTimerScale( configPtr->timeScale );
+   accessTimer(ZERO_TIMER, timer);
+
    // initialize display
       // function: displayPCB
-   displayPCB( PCBHead, logFile, dispFlag, timer, fileHolder, configPtr, 
-               usedMem );
+   displayPCB( PCBHead, logFile, dispFlag, timer, fileHolder, configPtr );
+
+   // initialize memory 
+      // function: memSim
+   memSim(NULL, logCode, dispFlag, fileHolder, START, configPtr, usedMem);
+    
+   // set all PCBs to ready
+      // function: setState
+   setState( PCBHead, READY_STATE, logCode, fileHolder, logFile );
+
+    // set display flag to run state
+    dispFlag = RUN;
+    
+    // Place each PCB (process) on a cpu run queue, each queue built in
+    // one heapify, then dispatch until all processes exit; each cpu 
+    // holds the timer in virtual time and resumes one process at a time,
+    // itself or on the worker pool
+       // function: initSimRun, placeProcesses, addTimerThread, 
+       //           dispatchProcesses, endTimerThread
+    initSimRun( &simRun, configPtr, fileHolder, simTimer, NULL );
+    placeProcesses( &simRun, PCBHead );
+    addTimerThread();
+    dispatchProcesses( &simRun );
+    endTimerThread();
+
+    // Finish simulation, stamped like every other event, then stop timer
+       // function: logEvent, clearSimRun, accessTimer
+    logEvent( &simRun, "OS: Simulation End\n" );
+    clearSimRun( &simRun );
+    accessTimer(STOP_TIMER, timer);
+
+    // release PCBs, the worker pool was joined at run clear
+    while (PCBHead != NULL) 
+       {
+        PCBHeadHolder = PCBHead;
+        PCBHead = PCBHead->nextPCB;
+        free(PCBHeadHolder);
+       }
+
+    // write file lines at the end
+       // function: dumpFile
+    if (logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE)
+       {
+        dumpFile(fileHolder, logFile);
+       }
+
+    // close log file
+    if (logFile != NULL)
+       {
+        fclose(logFile);
+       }
+
+    // release process index and run timer
+       // function: clearProcessIndex, bindSimTimer, clearSimTimer
+    clearProcessIndex( &procIndex );
+    bindSimTimer( NULL );
+    clearSimTimer( simTimer );
+   }
+
+/*
+Name: runSimStream
+Process: pipelined simulation driver; a cpu dispatcher takes each 
+         process block from the stream loader as soon as it is complete 
+         and queues it ready; at most one loader queue of processes is 
+         admitted per cpu and each is released at exit, so peak memory is
+         bounded by the window instead of the file
+Function Input/Parameters: configuration data (ConfigDataType *),
+                           started metadata stream (MetaDataStream *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: fopen, printf, accessTimer, initSimRun, logEvent, memSim, 
+              addTimerThread, dispatchProcesses, endTimerThread, 
+              finishMetaDataStream, clearSimRun, dumpFile, fclose
+*/
+void runSimStream( ConfigDataType *configPtr, MetaDataStream *streamPtr )
+   {
+    // initialize variables
+       // holder for log code
+       int logCode = configPtr->logToCode;
+
+       // run state shared by cpu dispatchers and worker pool
+       SimRunType simRun;
+
+       // Variable for logto file
+       FILE *logFile = NULL;
+
+       // Variable for logging to file at end, empty first line
+       logToFile *fileHolder = (logToFile *)malloc(sizeof(logToFile));
+
+       // timer and error data
+       char timer[STD_STR_LEN];
+       char errorMessage[MAX_STR_LEN];
+
+       // timer for this run, bound to this thread and worker pool
+       SimTimerType *simTimer = createSimTimer();
+
+    fileHolder->filePiece[ 0 ] = NULL_CHAR;
+    fileHolder->next = NULL;
+    fileHolder->tail = fileHolder;
+    fileHolder->eventNSec = NO_EVENT_TIME;
+
+    // open log file, check for failure, log to monitor instead
+       // function: fopen, printf
+    if(logCode == LOGTO_BOTH_CODE || logCode == LOGTO_FILE_CODE)
+       {
+        logFile = fopen( configPtr->logToFileName, "w" );
+
+        if( logFile == NULL )
+           {
+            printf( "\nLog File Access Error: %s, logging to monitor\n\n",
+                                                    configPtr->logToFileName );
+
+            logCode = LOGTO_MONITOR_CODE;
+            configPtr->logToCode = LOGTO_MONITOR_CODE;
+           }
+       }
+
+    // select real or virtual time and time scale, start timer, 
+    // display simulator start
+       // function: bindSimTimer, setVirtualTimer, setTimerScale, 
+       //           accessTimer, initSimRun, logEvent
+    bindSimTimer( simTimer );
+    setVirtualTimer( configPtr->timeModeCode == TIME_VIRTUAL_CODE );
+    setTimerScale( configPtr->timeScale );
+    accessTimer(ZERO_TIMER, timer);
+    initSimRun( &simRun, configPtr, fileHolder, simTimer, streamPtr );
+    logEvent( &simRun, "OS: Simulator start\n" );
+
+    // initialize memory 
+       // function: memSim
+    memSim(NULL, logCode, 0, fileHolder, START, configPtr, NULL);
+
+    // dispatch processes as they are loaded, cpu dispatchers admit
+    // loaded blocks between bursts and release each process at exit
+       // function: addTimerThread, dispatchProcesses, endTimerThread
+    addTimerThread();
+    dispatchProcesses( &simRun );
+    endTimerThread();
+
+    // end loading, check for metadata error found while streaming
+       // function: finishMetaDataStream
+    if( !finishMetaDataStream( streamPtr, errorMessage ) )
+       {
+        printf( "\nMetadata Upload Error: %s, simulation stopped\n\n", 
+                                                                 errorMessage );
+       }
+
+    // Finish simulation, stamped like every other event, then stop timer
+       // function: logEvent, clearSimRun, accessTimer
+    logEvent( &simRun, "OS: Simulation End\n" );
+    clearSimRun( &simRun );
+    accessTimer(STOP_TIMER, timer);
+
+    // write file lines at the end
+       // function: dumpFile
+    if (logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE)
+       {
+        dumpFile(fileHolder, logFile);
+       }
+
+    // close log file
+    if (logFile != NULL)
+       {
+        fclose(logFile);
+       }
+
+    // release run timer
+       // function: bindSimTimer, clearSimTimer
+    bindSimTimer( NULL );
+    clearSimTimer( simTimer );
+   }
+
+/*
+Name: simulateWorker
+Process: pool worker thread; takes each dispatched process as a task,
+         runs a burst of its ops, then yields it back to the dispatcher,
+         until the pool is stopped; a process is only runnable while the
+         dispatcher has set it running, so any worker may run any burst
+Function Input/Parameters: pointer to run (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, pthread_mutex_lock, pthread_cond_wait, 
+              setTimerRank, runProcessBurst, pthread_cond_signal, 
+              pthread_mutex_unlock
+*/
+void *simulateWorker( void *arg ) 
+{
+    SimRunType *runPtr = (SimRunType *)arg;
+    PCBType *pcbPtr;
+    int nextState;
+
+    // use the run timer
+       // function: bindSimTimer
+    bindSimTimer( runPtr->simTimer );
+
+    // loop across tasks to pool stop
+    while( true )
+    {
+        // wait for a dispatched process or stop
+           // function: pthread_mutex_lock, pthread_cond_wait, 
+           //           pthread_mutex_unlock
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        while( runPtr->taskHead == NULL && !runPtr->stopFlag )
+        {
+            pthread_cond_wait( &runPtr->taskCond, &runPtr->runMutex );
+        }
+
+        // check for stop with no task left
+        if( runPtr->taskHead == NULL )
+        {
+            pthread_mutex_unlock( &runPtr->runMutex );
+
+            return NULL;
+        }
+
+        pcbPtr = runPtr->taskHead;
+        runPtr->taskHead = pcbPtr->nextTask;
+
+        if( runPtr->taskHead == NULL )
+        {
+            runPtr->taskTail = NULL;
+        }
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+
+        // run ops on the cpu, waiting in virtual time as that cpu
+           // function: setTimerRank, runProcessBurst
+        setTimerRank( runPtr->deviceCount + pcbPtr->cpuID );
+
+        nextState = runProcessBurst( pcbPtr );
+
+        // yield cpu to dispatcher
+           // function: pthread_mutex_lock, pthread_cond_signal, 
+           //           pthread_mutex_unlock
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        pcbPtr->PCBStatus = nextState;
+        pthread_cond_signal( &runPtr->cpus[ pcbPtr->cpuID ].yieldCond );
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+    }
+}
+
+/*
+Name: runProcessBurst
+Process: runs ops of a dispatched process from its program counter, 
+         up to the end of the process, the quantum for preemptive 
+         policies, or an I/O op when the run has devices, which blocks 
+         the process with its program counter left on the op for the 
+         device to run; a cpu op is run in cycles, so a quantum that 
+         ends inside it preempts there, the cycles left kept on the PCB
+         for the next burst to resume, O(1) per preemption; a zero 
+         quantum preempts at each op boundary; cycles run add to the 
+         CFS virtual runtime
+Function Input/Parameters: pointer to running PCB (PCBType *)
+Function Output/Parameters: updated program counter, op cycles left,
+                            cycles left, virtual runtime and time left
+Function Output/Returned: state to leave the cpu in, READY_STATE,
+                          BLOCKED_STATE or EXIT_STATE (int)
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: isPreemptivePolicy, getOpName, snprintf, logEvent, runTimer,
+              nextOpCode
+*/
+int runProcessBurst( PCBType *pcbPtr )
+{
+    SimRunType *runPtr = pcbPtr->simRun;
+    ConfigDataType *configPtr = runPtr->configPtr;
+    bool preemptFlag = isPreemptivePolicy( configPtr->cpuSchedCode );
+    int quantumLeft = configPtr->cpuSchedCode == CPU_SCHED_MLFQ_CODE
+                            ? configPtr->mlfqQuanta[ pcbPtr->queueLevel ] 
+                                                : configPtr->quantumCycles;
+    int runCycles;
+    OpCodeType *opPtr;
+    char opName[MIN_STR_LEN];
+    char eventLine[MAX_STR_LEN];
+
+    // loop across ops to app end
+    while( pcbPtr->currentOp != NULL 
+                 && pcbPtr->currentOp->opKind != APP_END_OP 
+                             && pcbPtr->currentOp->opKind != APP_START_OP )
+    {
+        opPtr = pcbPtr->currentOp;
+
+        // set op name for timed ops
+           // function: getOpName
+        getOpName( opPtr, opName, sizeof(opName) );
+
+        // check for cpu op, run its cycles left up to the quantum
+           // function: snprintf, logEvent, runTimer
+        if( opPtr->opKind == CPU_PROCESS_OP )
+        {
+            // check for op not started, take all its cycles
+            if( pcbPtr->opCyclesLeft == 0 )
+            {
+                pcbPtr->opCyclesLeft = opPtr->intArg2;
+
+                snprintf(eventLine, sizeof(eventLine), 
+                 "Process: %lu, %s operation start\n", pcbPtr->PID, opName);
+            }
+
+            // otherwise, assume op was preempted, resume it
+            else
+            {
+                snprintf(eventLine, sizeof(eventLine), 
+                "Process: %lu, %s operation resume\n", pcbPtr->PID, opName);
+            }
+            logEvent( runPtr, eventLine );
+
+            runCycles = pcbPtr->opCyclesLeft;
+
+            if( preemptFlag && quantumLeft > 0 && runCycles > quantumLeft )
+            {
+                runCycles = quantumLeft;
+            }
+
+            runTimer( runCycles * configPtr->proCycleRate );
+
+            pcbPtr->opCyclesLeft -= runCycles;
+            pcbPtr->cycles -= runCycles;
+            pcbPtr->vruntime += runCycles;
+            pcbPtr->timeLeft -= runCycles * configPtr->proCycleRate;
+            quantumLeft -= runCycles;
+
+            // check for quantum expired inside the op
+            if( pcbPtr->opCyclesLeft > 0 )
+            {
+                return READY_STATE;
+            }
+
+            snprintf(eventLine, sizeof(eventLine), 
+                   "Process: %lu, %s operation end\n", pcbPtr->PID, opName);
+            logEvent( runPtr, eventLine );
+        }
+
+        // otherwise, check for I/O op, run op time
+           // function: snprintf, logEvent, runTimer
+        else if( opName[ 0 ] != NULL_CHAR )
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                 "Process: %lu, %s operation start\n", pcbPtr->PID, opName);
+            logEvent( runPtr, eventLine );
+
+            // check for I/O on a device, block until it completes
+            if( runPtr->devices != NULL )
+            {
+                return BLOCKED_STATE;
+            }
+
+            runTimer(opPtr->opTime);
+
+            snprintf(eventLine, sizeof(eventLine), 
+                   "Process: %lu, %s operation end\n", pcbPtr->PID, opName);
+            logEvent( runPtr, eventLine );
+
+            pcbPtr->timeLeft -= opPtr->opTime;
+            quantumLeft -= opPtr->intArg2;
+        }
+
+        // advance program counter
+        pcbPtr->currentOp = nextOpCode( opPtr );
+
+        // check for quantum expired with run time left, preemptive only
+        if( preemptFlag && quantumLeft <= 0 && pcbPtr->timeLeft > 0 )
+        {
+            return READY_STATE;
+        }
+    }
+
+    // process ran to app end
+    return EXIT_STATE;
+}
+
+/*
+Name: getOpName
+Process: sets the display name of a timed op, empty for other ops
+Function Input/Parameters: pointer to op code (const OpCodeType *),
+                           name buffer size (int)
+Function Output/Parameters: op name (char *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: snprintf, strArgCodeToString
+*/
+void getOpName( const OpCodeType *opPtr, char *opName, int nameSize )
+{
+    switch( opPtr->opKind )
+    {
+        case CPU_PROCESS_OP:
+
+           snprintf(opName, nameSize, "cpu process");
+           break;
+
+        case DEV_IN_OP:
+
+           snprintf(opName, nameSize, "%s input",
+                                   strArgCodeToString(opPtr->strArg1));
+           break;
+
+        case DEV_OUT_OP:
+
+           snprintf(opName, nameSize, "%s output",
+                                   strArgCodeToString(opPtr->strArg1));
+           break;
+
+        default:
+
+           opName[ 0 ] = NULL_CHAR;
+           break;
+    }
+}
+
+/*
+Name: dispatchProcesses
+Process: runs the dispatcher of each simulated cpu, cpu 0 on the 
+         calling thread and the rest on their own threads, until no 
+         process is left; each cpu holds the run timer while it works;
+         a run with devices then reports cpu utilization, the share of 
+         cpu time spent running processes, and how much device time 
+         overlapped it
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: addSimTimerThread, pthread_create, endSimTimerThread,
+              dispatchCpu, setTimerRank, pthread_join, markRunLoad, snprintf, 
+              logEvent
+*/
+void dispatchProcesses( SimRunType *runPtr )
+{
+    int cpuIndex;
+    double utilization = 0.0;
+    char eventLine[MAX_STR_LEN];
+
+    // start dispatchers past cpu 0, timer held for each before it starts
+       // function: addSimTimerThread, pthread_create, endSimTimerThread
+    for( cpuIndex = 1; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        addSimTimerThread( runPtr->simTimer );
+
+        // check for thread not started, its queue is left to stealing
+        if( pthread_create( &runPtr->cpus[ cpuIndex ].thread, NULL, 
+                        simulateCpu, (void *)&runPtr->cpus[ cpuIndex ] ) != 0 )
+        {
+            endSimTimerThread( runPtr->simTimer );
+
+            runPtr->cpus[ cpuIndex ].startedFlag = false;
+        }
+    }
+
+    // dispatch cpu 0 here, then wait for the others
+       // function: dispatchCpu, pthread_join
+    dispatchCpu( &runPtr->cpus[ 0 ] );
+
+    // the calling thread leaves the cpu rank behind
+       // function: setTimerRank
+    setTimerRank( NO_TIMER_RANK );
+
+    for( cpuIndex = 1; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        if( runPtr->cpus[ cpuIndex ].startedFlag )
+        {
+            pthread_join( runPtr->cpus[ cpuIndex ].thread, NULL );
+        }
+    }
+
+    // check for devices, close load times and report
+       // function: markRunLoad, snprintf, logEvent
+    if( runPtr->devices != NULL )
+    {
+        markRunLoad( runPtr, 0, 0 );
+
+        if( runPtr->loadNSec > 0 )
+        {
+            utilization = 100.0 * (double)runPtr->cpuBusyNSec 
+                           / ( (double)runPtr->loadNSec * runPtr->cpuCount );
+        }
+
+        snprintf(eventLine, sizeof(eventLine), 
+               "OS: CPU use %.1f%%, I/O busy %lld ms, %lld ms overlapped\n", 
+                           utilization, runPtr->deviceBusyNSec / 1000000LL, 
+                                           runPtr->overlapNSec / 1000000LL);
+        logEvent( runPtr, eventLine );
+    }
+}
+
+/*
+Name: simulateCpu
+Process: dispatcher thread of a cpu past cpu 0; releases the run timer
+         it was started holding once the run ends
+Function Input/Parameters: pointer to cpu (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, dispatchCpu, endTimerThread
+*/
+void *simulateCpu( void *arg )
+{
+    CpuRunType *cpuPtr = (CpuRunType *)arg;
+
+    // use the run timer, dispatch, release timer
+       // function: bindSimTimer, dispatchCpu, endTimerThread
+    bindSimTimer( cpuPtr->simRun->simTimer );
+
+    dispatchCpu( cpuPtr );
+
+    endTimerThread();
+
+    return NULL;
+}
+
+/*
+Name: dispatchCpu
+Process: scheduler loop of one cpu; selects the process at its run queue
+         root, or steals one from the busiest cpu, resumes it from its 
+         program counter until it yields, as a coroutine on this thread,
+         a function call per switch, or as a task handed to the worker 
+         pool in pool mode; then re-keys it in place, or 
+         removes it at exit or to block on its device, which raises an
+         interrupt when done; a cpu with nothing to run waits idle
+         without holding the run timer, until no process is left
+Function Input/Parameters: pointer to cpu (CpuRunType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: setTimerRank, admitStreamProcesses, drainInterrupts, 
+              pthread_mutex_lock, boostProcesses, selectProcess, levelReadyPCB, waitIdleCpu, 
+              pthread_mutex_unlock, snprintf, logEvent,
+              markRunLoad, runProcessBurst, pthread_cond_signal, 
+              pthread_cond_wait, requeueReadyQueue, removeReadyQueue, getOpName, 
+              submitDeviceRequest, pthread_cond_broadcast, clearMetaDataList,
+              free
+*/
+void dispatchCpu( CpuRunType *cpuPtr )
+{
+    SimRunType *runPtr = cpuPtr->simRun;
+    PCBType *pcbPtr;
+    int nextState, fromCpu, level;
+    bool boostFlag;
+    char opName[MIN_STR_LEN];
+    char eventLine[MAX_STR_LEN];
+
+    // wait in virtual time after all devices, in cpu order
+       // function: setTimerRank
+    setTimerRank( runPtr->deviceCount + cpuPtr->cpuID );
+
+    // loop across selections to run end
+    while( true )
+    {
+        // admit loaded processes, take completed I/O, select next process
+           // function: admitStreamProcesses, drainInterrupts, 
+           //           pthread_mutex_lock, boostProcesses, selectProcess
+        admitStreamProcesses( runPtr, cpuPtr );
+        drainInterrupts( runPtr, cpuPtr );
+
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        boostFlag = boostProcesses( runPtr );
+
+        pcbPtr = selectProcess( runPtr, cpuPtr, &fromCpu );
+
+        // check for nothing to run
+        if( pcbPtr == NULL )
+        {
+            // check for run over
+            if( runPtr->liveCount == 0 && runPtr->streamPtr == NULL )
+            {
+                pthread_mutex_unlock( &runPtr->runMutex );
+
+                return;
+            }
+
+            // wait idle unless loading is free to take over
+               // function: waitIdleCpu, pthread_mutex_unlock
+            if( runPtr->streamPtr == NULL || runPtr->admitFlag )
+            {
+                waitIdleCpu( runPtr );
+            }
+
+            pthread_mutex_unlock( &runPtr->runMutex );
+
+            continue;
+        }
+
+        cpuPtr->busyFlag = true;
+
+        // settle MLFQ level for the quantum, boost may have reset it
+           // function: levelReadyPCB
+        level = levelReadyPCB( &cpuPtr->readyQueue, pcbPtr );
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+
+        // display boost, steal and selection
+           // function: snprintf, logEvent
+        if( boostFlag )
+        {
+            logEvent( runPtr, "OS: Priority boost, all processes to level 0\n" );
+        }
+
+        if( fromCpu != cpuPtr->cpuID )
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                          "OS: CPU %d took process %lu from CPU %d\n", 
+                                     cpuPtr->cpuID, pcbPtr->PID, fromCpu);
+            logEvent( runPtr, eventLine );
+        }
+
+        if( runPtr->cpuCount > 1 )
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                  "OS: Process %lu selected on CPU %d with %d ms remaining\n", 
+                           pcbPtr->PID, cpuPtr->cpuID, pcbPtr->timeLeft);
+        }
+        else
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                        "OS: Process %lu selected with %d ms remaining\n", 
+                                              pcbPtr->PID, pcbPtr->timeLeft);
+        }
+        logEvent( runPtr, eventLine );
+
+        snprintf(eventLine, sizeof(eventLine), 
+                    "OS: Process %lu set from READY to RUNNING\n", pcbPtr->PID);
+        logEvent( runPtr, eventLine );
+
+        // check for coroutine mode, resume process here until it yields;
+        // it is this cpu's busy root, so no other thread touches it
+           // function: markRunLoad, runProcessBurst
+        markRunLoad( runPtr, 1, 0 );
+
+        if( runPtr->coroutineFlag )
+        {
+            pcbPtr->PCBStatus = RUNNING_STATE;
+
+            nextState = runProcessBurst( pcbPtr );
+
+            pcbPtr->PCBStatus = nextState;
+        }
+
+        // otherwise, hand cpu to worker pool as a task, wait for it to 
+        // yield
+           // function: pthread_mutex_lock, pthread_cond_signal,
+           //           pthread_cond_wait, pthread_mutex_unlock
+        else
+        {
+            pthread_mutex_lock( &runPtr->runMutex );
+
+            pcbPtr->PCBStatus = RUNNING_STATE;
+            pcbPtr->nextTask = NULL;
+
+            if( runPtr->taskTail == NULL )
+            {
+                runPtr->taskHead = pcbPtr;
+            }
+            else
+            {
+                runPtr->taskTail->nextTask = pcbPtr;
+            }
+
+            runPtr->taskTail = pcbPtr;
+            pthread_cond_signal( &runPtr->taskCond );
+
+            while( pcbPtr->PCBStatus == RUNNING_STATE )
+            {
+                pthread_cond_wait( &cpuPtr->yieldCond, &runPtr->runMutex );
+            }
+
+            nextState = pcbPtr->PCBStatus;
+
+            pthread_mutex_unlock( &runPtr->runMutex );
+        }
+
+        markRunLoad( runPtr, -1, 0 );
+
+        // check for preempted, re-key in place
+           // function: snprintf, logEvent, pthread_mutex_lock, 
+           //           requeueReadyQueue, pthread_mutex_unlock
+        if( nextState == READY_STATE )
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                       "OS: Process %lu quantum time out\n", pcbPtr->PID);
+            logEvent( runPtr, eventLine );
+
+            snprintf(eventLine, sizeof(eventLine), 
+                    "OS: Process %lu set from RUNNING to READY\n", pcbPtr->PID);
+            logEvent( runPtr, eventLine );
+
+            pthread_mutex_lock( &runPtr->runMutex );
+
+            requeueReadyQueue( &cpuPtr->readyQueue, pcbPtr );
+            cpuPtr->busyFlag = false;
+
+            pthread_mutex_unlock( &runPtr->runMutex );
+
+            // check for MLFQ demotion, display new level
+            if( pcbPtr->queueLevel != level )
+            {
+                snprintf(eventLine, sizeof(eventLine), 
+                      "OS: Process %lu set to level %d\n", pcbPtr->PID, 
+                                                          pcbPtr->queueLevel);
+                logEvent( runPtr, eventLine );
+            }
+        }
+
+        // check for I/O, dequeue process while its device runs the op;
+        // it stays live and returns through an interrupt
+           // function: getOpName, snprintf, logEvent, pthread_mutex_lock, 
+           //           removeReadyQueue, pthread_mutex_unlock, 
+           //           submitDeviceRequest
+        else if( nextState == BLOCKED_STATE )
+        {
+            getOpName( pcbPtr->currentOp, opName, sizeof(opName) );
+
+            snprintf(eventLine, sizeof(eventLine), 
+                                "OS: Process %lu blocked for %s operation\n", 
+                                                         pcbPtr->PID, opName);
+            logEvent( runPtr, eventLine );
+
+            snprintf(eventLine, sizeof(eventLine), 
+                  "OS: Process %lu set from RUNNING to BLOCKED\n", pcbPtr->PID);
+            logEvent( runPtr, eventLine );
+
+            pthread_mutex_lock( &runPtr->runMutex );
+
+            removeReadyQueue( &cpuPtr->readyQueue, pcbPtr );
+            cpuPtr->busyFlag = false;
+
+            pthread_mutex_unlock( &runPtr->runMutex );
+
+            submitDeviceRequest( runPtr, pcbPtr );
+        }
+
+        // otherwise, assume process ended, dequeue it
+           // function: snprintf, logEvent, pthread_mutex_lock, 
+           //           removeReadyQueue, pthread_cond_broadcast,
+           //           pthread_mutex_unlock
+        else
+        {
+            snprintf(eventLine, sizeof(eventLine), 
+                                    "OS: Process %lu ended\n", pcbPtr->PID);
+            logEvent( runPtr, eventLine );
+
+            snprintf(eventLine, sizeof(eventLine), 
+                               "OS: Process %lu set to EXIT\n", pcbPtr->PID);
+            logEvent( runPtr, eventLine );
+
+            pthread_mutex_lock( &runPtr->runMutex );
+
+            removeReadyQueue( &cpuPtr->readyQueue, pcbPtr );
+            cpuPtr->busyFlag = false;
+            runPtr->liveCount--;
+
+            // check for last process, end idle cpus
+            if( runPtr->liveCount == 0 && runPtr->streamPtr == NULL )
+            {
+                pthread_cond_broadcast( &runPtr->idleCond );
+            }
+
+            pthread_mutex_unlock( &runPtr->runMutex );
+
+            // streamed processes are released at exit
+               // function: clearMetaDataList, free
+            if( runPtr->streamFlag )
+            {
+                clearMetaDataList( pcbPtr->appStart );
+                free( pcbPtr );
+            }
+        }
+    }
+}
+
+/*
+Name: boostProcesses
+Process: MLFQ priority boost; once the boost time has passed since the 
+         last one, moves every process, queued, running or blocked, back
+         to level 0 on all cpus together, so their level epochs stay 
+         equal and steals keep levels; called with runMutex held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated run queues and next boost time 
+                            (SimRunType *)
+Function Output/Returned: Boolean result, true if boosted (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: lapSimTimer, boostReadyQueue
+*/
+bool boostProcesses( SimRunType *runPtr )
+{
+    ConfigDataType *configPtr = runPtr->configPtr;
+    long long nowNSec;
+    int cpuIndex;
+
+    // check for MLFQ with boosting on
+    if( configPtr->cpuSchedCode != CPU_SCHED_MLFQ_CODE 
+                                          || configPtr->mlfqBoostTime == 0 )
+    {
+        return false;
+    }
+
+    // check for boost time not reached
+       // function: lapSimTimer
+    nowNSec = lapSimTimer( runPtr->simTimer );
+
+    if( nowNSec < runPtr->boostNSec )
+    {
+        return false;
+    }
+
+    // boost each cpu, set next boost time
+       // function: boostReadyQueue
+    for( cpuIndex = 0; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        boostReadyQueue( &runPtr->cpus[ cpuIndex ].readyQueue );
+    }
+
+    runPtr->boostNSec = nowNSec + configPtr->mlfqBoostTime * 1000000LL;
+
+    return true;
+}
+
+/*
+Name: selectProcess
+Process: picks the next process for a cpu, its own run queue root, or 
+         otherwise one stolen from the cpu with the most waiting: the 
+         root of an idle cpu, a leaf of a busy one; called with runMutex
+         held
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to cpu (CpuRunType *)
+Function Output/Parameters: cpu the process came from (int *)
+Function Output/Returned: selected PCB, NULL if none (PCBType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: peekReadyQueue, popReadyQueue, stealReadyQueue, 
+              pushReadyQueue
+*/
+PCBType *selectProcess( SimRunType *runPtr, CpuRunType *cpuPtr, 
+                                                              int *fromCpu )
+{
+    PCBType *pcbPtr;
+    CpuRunType *victimPtr = NULL;
+    int cpuIndex, waitCount, mostWaiting = 0;
+
+    // check own queue first
+       // function: peekReadyQueue
+    *fromCpu = cpuPtr->cpuID;
+    pcbPtr = peekReadyQueue( &cpuPtr->readyQueue );
+
+    if( pcbPtr != NULL )
+    {
+        return pcbPtr;
+    }
+
+    // find cpu with most processes waiting, not running
+    for( cpuIndex = 0; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        waitCount = runPtr->cpus[ cpuIndex ].readyQueue.count
+                               - ( runPtr->cpus[ cpuIndex ].busyFlag ? 1 : 0 );
+
+        if( waitCount > mostWaiting )
+        {
+            mostWaiting = waitCount;
+            victimPtr = &runPtr->cpus[ cpuIndex ];
+        }
+    }
+
+    // check for nothing to steal
+    if( victimPtr == NULL )
+    {
+        return NULL;
+    }
+
+    // steal, move to own queue
+       // function: stealReadyQueue, popReadyQueue, pushReadyQueue
+    if( victimPtr->busyFlag )
+    {
+        pcbPtr = stealReadyQueue( &victimPtr->readyQueue );
+    }
+    else
+    {
+        pcbPtr = popReadyQueue( &victimPtr->readyQueue );
+    }
+
+    pcbPtr->cpuID = cpuPtr->cpuID;
+    pushReadyQueue( &cpuPtr->readyQueue, pcbPtr );
+
+    *fromCpu = victimPtr->cpuID;
+
+    return pcbPtr;
+}
+
+/*
+Name: waitIdleCpu
+Process: parks a cpu with nothing to run; it gives up the run timer so 
+         virtual time can pass without it, and waits to be woken for new
+         work, holding the timer again, or for the run to end; the idle
+         count is raised before pending interrupts are checked, and
+         devices push before reading it, so an interrupt is never left
+         with every cpu asleep; called with runMutex held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated idle counts (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: __atomic_add_fetch, __atomic_load_n, __atomic_sub_fetch,
+              endSimTimerThread, pthread_cond_wait, addSimTimerThread
+*/
+void waitIdleCpu( SimRunType *runPtr )
+{
+    // go idle, check for interrupts to drain first
+       // function: __atomic_add_fetch, __atomic_load_n, __atomic_sub_fetch
+    __atomic_add_fetch( &runPtr->idleCount, 1, __ATOMIC_SEQ_CST );
+
+    if( __atomic_load_n( &runPtr->pendingInterrupts, __ATOMIC_SEQ_CST ) > 0 )
+    {
+        __atomic_sub_fetch( &runPtr->idleCount, 1, __ATOMIC_SEQ_CST );
+
+        return;
+    }
+
+    // release timer, wait for wake or run end
+       // function: endSimTimerThread, pthread_cond_wait
+    endSimTimerThread( runPtr->simTimer );
+
+    while( runPtr->wakeCount == 0 
+             && ( runPtr->liveCount > 0 || runPtr->streamPtr != NULL ) )
+    {
+        pthread_cond_wait( &runPtr->idleCond, &runPtr->runMutex );
+    }
+
+    // check for woken, waker took the timer for this cpu
+    if( runPtr->wakeCount > 0 )
+    {
+        runPtr->wakeCount--;
+    }
+
+    // otherwise, run over, hold timer again for the caller to release
+       // function: __atomic_sub_fetch, addSimTimerThread
+    else
+    {
+        __atomic_sub_fetch( &runPtr->idleCount, 1, __ATOMIC_SEQ_CST );
+        addSimTimerThread( runPtr->simTimer );
+    }
+}
+
+/*
+Name: wakeIdleCpu
+Process: wakes one idle cpu, if any, taking the run timer for it so 
+         virtual time does not pass before it runs; called with 
+         runMutex held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated idle counts (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: __atomic_load_n, __atomic_sub_fetch, addSimTimerThread, 
+              pthread_cond_signal
+*/
+void wakeIdleCpu( SimRunType *runPtr )
+{
+    if( __atomic_load_n( &runPtr->idleCount, __ATOMIC_SEQ_CST ) > 0 )
+    {
+        __atomic_sub_fetch( &runPtr->idleCount, 1, __ATOMIC_SEQ_CST );
+        runPtr->wakeCount++;
+
+        addSimTimerThread( runPtr->simTimer );
+        pthread_cond_signal( &runPtr->idleCond );
+    }
+}
+
+/*
+Name: raiseInterrupt
+Process: device side; signals I/O completion of a blocked process by 
+         pushing its interrupt lock free; only when a cpu is idle does 
+         it take runMutex, to wake one
+Function Input/Parameters: pointer to blocked PCB (PCBType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pushInterruptQueue, __atomic_add_fetch, __atomic_load_n,
+              pthread_mutex_lock, wakeIdleCpu, pthread_mutex_unlock
+*/
+void raiseInterrupt( PCBType *pcbPtr )
+{
+    SimRunType *runPtr = pcbPtr->simRun;
+
+    // push interrupt, count it pending
+       // function: pushInterruptQueue, __atomic_add_fetch
+    pcbPtr->ioInterrupt.pcbPtr = pcbPtr;
+    pushInterruptQueue( &runPtr->interrupts, &pcbPtr->ioInterrupt );
+
+    __atomic_add_fetch( &runPtr->pendingInterrupts, 1, __ATOMIC_SEQ_CST );
+
+    // check for an idle cpu to take it
+       // function: __atomic_load_n, pthread_mutex_lock, wakeIdleCpu, 
+       //           pthread_mutex_unlock
+    if( __atomic_load_n( &runPtr->idleCount, __ATOMIC_SEQ_CST ) > 0 )
+    {
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        wakeIdleCpu( runPtr );
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+    }
+}
+
+/*
+Name: drainInterrupts
+Process: between quanta, takes each I/O completion interrupt off the 
+         run interrupt queue and sets its process ready on this cpu;
+         the queue has one consumer, so a cpu that finds another 
+         draining goes on with its own queue
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to draining cpu (CpuRunType *)
+Function Output/Parameters: updated run queues (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: __atomic_load_n, __atomic_exchange_n, popInterruptQueue, 
+              __atomic_sub_fetch, snprintf, logEvent, pthread_mutex_lock, 
+              pushReadyQueue, pthread_mutex_unlock, __atomic_store_n
+*/
+void drainInterrupts( SimRunType *runPtr, CpuRunType *cpuPtr )
+{
+    Interrupt *intPtr;
+    PCBType *pcbPtr;
+    char eventLine[STD_STR_LEN];
+
+    // check for nothing pending or another cpu draining
+       // function: __atomic_load_n, __atomic_exchange_n
+    if( __atomic_load_n( &runPtr->pendingInterrupts, __ATOMIC_ACQUIRE ) == 0
+         || __atomic_exchange_n( &runPtr->drainFlag, true, __ATOMIC_ACQUIRE ) )
+    {
+        return;
+    }
+
+    // take each completed process, set it ready here
+       // function: popInterruptQueue, __atomic_sub_fetch, snprintf, 
+       //           logEvent, pthread_mutex_lock, pushReadyQueue,
+       //           pthread_mutex_unlock
+    while( ( intPtr = popInterruptQueue( &runPtr->interrupts ) ) != NULL )
+    {
+        pcbPtr = intPtr->pcbPtr;
+
+        __atomic_sub_fetch( &runPtr->pendingInterrupts, 1, __ATOMIC_SEQ_CST );
+
+        snprintf(eventLine, sizeof(eventLine), 
+                        "OS: Interrupt, process %lu I/O complete\n", pcbPtr->PID);
+        logEvent( runPtr, eventLine );
+
+        snprintf(eventLine, sizeof(eventLine), 
+                    "OS: Process %lu set from BLOCKED to READY\n", pcbPtr->PID);
+        logEvent( runPtr, eventLine );
+
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        pcbPtr->PCBStatus = READY_STATE;
+        pcbPtr->cpuID = cpuPtr->cpuID;
+        pushReadyQueue( &cpuPtr->readyQueue, pcbPtr );
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+    }
+
+    // release drain
+       // function: __atomic_store_n
+    __atomic_store_n( &runPtr->drainFlag, false, __ATOMIC_RELEASE );
+}
+
+/*
+Name: markRunLoad
+Process: changes the busy cpu and device counts of a run with devices, 
+         first adding the time since the last change to cpu busy time, 
+         once per busy cpu, to device busy time if any device was busy, 
+         and to overlapped time if both were; times are taken under the
+         load lock so changes are counted in order
+Function Input/Parameters: pointer to run (SimRunType *),
+                           change in busy cpus (int),
+                           change in busy devices (int)
+Function Output/Parameters: updated load times (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, lapSimTimer, pthread_mutex_unlock
+*/
+void markRunLoad( SimRunType *runPtr, int cpuChange, int deviceChange )
+{
+    long long nowNSec, spanNSec;
+
+    // check for no devices, cpu time is not tracked
+    if( runPtr->devices == NULL )
+    {
+        return;
+    }
+
+    // add time at the old load, then change it
+       // function: pthread_mutex_lock, lapSimTimer, pthread_mutex_unlock
+    pthread_mutex_lock( &runPtr->loadMutex );
+
+    nowNSec = lapSimTimer( runPtr->simTimer );
+    spanNSec = nowNSec - runPtr->loadNSec;
+
+    if( spanNSec > 0 )
+    {
+        runPtr->cpuBusyNSec += spanNSec * runPtr->busyCpus;
+
+        if( runPtr->busyDevices > 0 )
+        {
+            runPtr->deviceBusyNSec += spanNSec;
+
+            if( runPtr->busyCpus > 0 )
+            {
+                runPtr->overlapNSec += spanNSec;
+            }
+        }
+
+        runPtr->loadNSec = nowNSec;
+    }
+
+    runPtr->busyCpus += cpuChange;
+    runPtr->busyDevices += deviceChange;
+
+    pthread_mutex_unlock( &runPtr->loadMutex );
+}
+
+/*
+Name: submitDeviceRequest
+Process: queues a blocked process on the device of its I/O op; the
+         device worker starts on first use, and an idle one is handed
+         the run timer before it is signaled, so virtual time does not
+         pass the request; if the worker cannot start, the request is 
+         serviced in place
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to blocked PCB (PCBType *)
+Function Output/Parameters: updated device queue (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_create, pthread_mutex_unlock,
+              serviceDeviceRequest, addSimTimerThread, pthread_cond_signal
+*/
+void submitDeviceRequest( SimRunType *runPtr, PCBType *pcbPtr )
+{
+    DeviceRunType *devicePtr 
+                       = &runPtr->devices[ pcbPtr->currentOp->strArg1 ];
+
+    // start device worker as needed
+       // function: pthread_mutex_lock, pthread_create, pthread_mutex_unlock,
+       //           serviceDeviceRequest
+    pthread_mutex_lock( &devicePtr->deviceMutex );
+
+    if( !devicePtr->startedFlag )
+    {
+        devicePtr->startedFlag = pthread_create( &devicePtr->thread, NULL, 
+                                    simulateDevice, (void *)devicePtr ) == 0;
+    }
+
+    if( !devicePtr->startedFlag )
+    {
+        pthread_mutex_unlock( &devicePtr->deviceMutex );
+
+        serviceDeviceRequest( runPtr, pcbPtr );
+
+        return;
+    }
+
+    // queue request, take timer for an idle device and signal it
+       // function: addSimTimerThread, pthread_cond_signal, 
+       //           pthread_mutex_unlock
+    pcbPtr->nextIO = NULL;
+
+    if( devicePtr->queueTail == NULL )
+    {
+        devicePtr->queueHead = pcbPtr;
+    }
+    else
+    {
+        devicePtr->queueTail->nextIO = pcbPtr;
+    }
+
+    devicePtr->queueTail = pcbPtr;
+
+    if( !devicePtr->busyFlag )
+    {
+        devicePtr->busyFlag = true;
+        addSimTimerThread( runPtr->simTimer );
+    }
+
+    pthread_cond_signal( &devicePtr->requestCond );
+
+    pthread_mutex_unlock( &devicePtr->deviceMutex );
+}
+
+/*
+Name: simulateDevice
+Process: device worker thread; services its queue in request order, 
+         each request on the timer it was handed, and gives the timer
+         up while the queue is empty, until stopped
+Function Input/Parameters: pointer to device (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, setTimerRank, pthread_mutex_lock, 
+              endSimTimerThread, pthread_cond_wait, pthread_mutex_unlock, 
+              serviceDeviceRequest
+*/
+void *simulateDevice( void *arg )
+{
+    DeviceRunType *devicePtr = (DeviceRunType *)arg;
+    SimRunType *runPtr = devicePtr->simRun;
+    PCBType *pcbPtr;
+
+    // use the run timer, device completions resume before cpus at the 
+    // same virtual time
+       // function: bindSimTimer, setTimerRank
+    bindSimTimer( runPtr->simTimer );
+    setTimerRank( devicePtr->deviceCode );
+
+    // loop across requests to device stop
+       // function: pthread_mutex_lock
+    pthread_mutex_lock( &devicePtr->deviceMutex );
+
+    while( true )
+    {
+        // check for empty queue, release timer, wait for request or stop
+           // function: endSimTimerThread, pthread_cond_wait
+        if( devicePtr->queueHead == NULL )
+        {
+            if( devicePtr->busyFlag )
+            {
+                devicePtr->busyFlag = false;
+                endSimTimerThread( runPtr->simTimer );
+            }
+
+            if( devicePtr->stopFlag )
+            {
+                break;
+            }
+
+            pthread_cond_wait( &devicePtr->requestCond, 
+                                                   &devicePtr->deviceMutex );
+
+            continue;
+        }
+
+        // take oldest request, service it unlocked
+           // function: pthread_mutex_unlock, serviceDeviceRequest, 
+           //           pthread_mutex_lock
+        pcbPtr = devicePtr->queueHead;
+        devicePtr->queueHead = pcbPtr->nextIO;
+
+        if( devicePtr->queueHead == NULL )
+        {
+            devicePtr->queueTail = NULL;
+        }
+
+        pthread_mutex_unlock( &devicePtr->deviceMutex );
+
+        serviceDeviceRequest( runPtr, pcbPtr );
+
+        pthread_mutex_lock( &devicePtr->deviceMutex );
+    }
+
+       // function: pthread_mutex_unlock
+    pthread_mutex_unlock( &devicePtr->deviceMutex );
+
+    return NULL;
+}
+
+/*
+Name: serviceDeviceRequest
+Process: runs the I/O op of a blocked process on its device, advances
+         its program counter and raises its completion interrupt; the 
+         device is marked free first, so its load is closed before the 
+         process can run again
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to blocked PCB (PCBType *)
+Function Output/Parameters: updated program counter and time left
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: markRunLoad, runTimer, getOpName, snprintf, logEvent, 
+              nextOpCode, raiseInterrupt
+*/
+void serviceDeviceRequest( SimRunType *runPtr, PCBType *pcbPtr )
+{
+    OpCodeType *opPtr = pcbPtr->currentOp;
+    char opName[MIN_STR_LEN];
+    char eventLine[MAX_STR_LEN];
+
+    // run op time on the device
+       // function: markRunLoad, runTimer
+    markRunLoad( runPtr, 0, 1 );
+
+    runTimer(opPtr->opTime);
+
+    markRunLoad( runPtr, 0, -1 );
+
+    // display op end, advance program counter, signal completion
+       // function: getOpName, snprintf, logEvent, raiseInterrupt
+    getOpName( opPtr, opName, sizeof(opName) );
+
+    snprintf(eventLine, sizeof(eventLine), 
+                   "Process: %lu, %s operation end\n", pcbPtr->PID, opName);
+    logEvent( runPtr, eventLine );
+
+    pcbPtr->timeLeft -= opPtr->opTime;
+    pcbPtr->currentOp = nextOpCode( opPtr );
+
+    raiseInterrupt( pcbPtr );
+}
+
+/*
+Name: admitStreamProcesses
+Process: moves loaded process blocks from the stream loader into a cpu
+         run queue, up to one loader queue of processes on that cpu, 
+         waiting only when the cpu has nothing else to run; one cpu 
+         admits at a time, others go on with their queues
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to admitting cpu (CpuRunType *)
+Function Output/Parameters: updated run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: pthread_mutex_lock, pthread_mutex_unlock, getStreamProcess,
+              pollStreamProcess, decodeMetaData, indexProcess, addPCB, 
+              setState, startProcess, pushReadyQueue, wakeIdleCpu,
+              pthread_cond_broadcast
+*/
+void admitStreamProcesses( SimRunType *runPtr, CpuRunType *cpuPtr )
+{
+    OpCodeType *blockHead;
+    ProcessIndexType procInfo;
+    PCBType *newPCB;
+    int queuedCount;
+    bool loadedFlag = false;
+
+    // claim admission, check for loaded or another cpu admitting
+       // function: pthread_mutex_lock, pthread_mutex_unlock
+    pthread_mutex_lock( &runPtr->runMutex );
+
+    if( runPtr->streamPtr == NULL || runPtr->admitFlag )
+    {
+        pthread_mutex_unlock( &runPtr->runMutex );
+
+        return;
+    }
+
+    runPtr->admitFlag = true;
+    queuedCount = cpuPtr->readyQueue.count;
+
+    pthread_mutex_unlock( &runPtr->runMutex );
+
+    // loop while under the admission window
+    while( queuedCount < STREAM_QUEUE_CAPACITY )
+    {
+        // wait for a block only when nothing is ready to run
+           // function: getStreamProcess, pollStreamProcess
+        if( queuedCount == 0 )
+        {
+            blockHead = getStreamProcess( runPtr->streamPtr );
+
+            // check for end of loading
+            loadedFlag = blockHead == NULL;
+        }
+        else
+        {
+            blockHead = pollStreamProcess( runPtr->streamPtr );
+        }
+
+        // check for no block available
+        if( blockHead == NULL )
+        {
+            break;
+        }
+
+        // decode block, index it, build its PCB, set it ready
+           // function: decodeMetaData, indexProcess, addPCB, 
+           //           pthread_mutex_lock, setState, pthread_mutex_unlock
+        decodeMetaData( blockHead, runPtr->configPtr );
+        indexProcess( blockHead, 0, &procInfo );
+        newPCB = addPCB( runPtr->configPtr, &procInfo, runPtr->nextPID, NULL );
+        runPtr->nextPID++;
+
+        pthread_mutex_lock( &runPtr->logMutex );
+
+        setState( newPCB, READY_STATE, runPtr->configPtr->logToCode, 
+                                                   runPtr->fileHolder, NULL );
+
+        pthread_mutex_unlock( &runPtr->logMutex );
+
+        // queue on this cpu, wake an idle cpu once there is spare work
+           // function: pthread_mutex_lock, startProcess, pushReadyQueue, 
+           //           wakeIdleCpu, pthread_mutex_unlock
+        pthread_mutex_lock( &runPtr->runMutex );
+
+        startProcess( runPtr, newPCB, cpuPtr->cpuID );
+        pushReadyQueue( &cpuPtr->readyQueue, newPCB );
+        runPtr->liveCount++;
+
+        queuedCount = cpuPtr->readyQueue.count;
+
+        if( queuedCount > 1 )
+        {
+            wakeIdleCpu( runPtr );
+        }
+
+        pthread_mutex_unlock( &runPtr->runMutex );
+    }
+
+    // release admission, end loading or let an idle cpu take it over
+       // function: pthread_mutex_lock, pthread_cond_broadcast, 
+       //           wakeIdleCpu, pthread_mutex_unlock
+    pthread_mutex_lock( &runPtr->runMutex );
+
+    runPtr->admitFlag = false;
+
+    if( loadedFlag )
+    {
+        runPtr->streamPtr = NULL;
+
+        if( runPtr->liveCount == 0 )
+        {
+            pthread_cond_broadcast( &runPtr->idleCond );
+        }
+    }
+
+    else
+    {
+        wakeIdleCpu( runPtr );
+    }
+
+    pthread_mutex_unlock( &runPtr->runMutex );
+}
+
+/*
+Name: placeProcesses
+Process: spreads a PCB list over the cpu run queues in PID order, round
+         robin, then heapifies each queue once
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to PCB list head (PCBType *)
+Function Output/Parameters: updated run queues (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: startProcess, appendReadyQueue, heapifyReadyQueue
+*/
+void placeProcesses( SimRunType *runPtr, PCBType *headPtr )
+{
+    int cpuIndex = 0;
+
+    // append each PCB to the next cpu in turn
+       // function: startProcess, appendReadyQueue
+    while( headPtr != NULL )
+    {
+        startProcess( runPtr, headPtr, cpuIndex );
+        appendReadyQueue( &runPtr->cpus[ cpuIndex ].readyQueue, headPtr );
+        runPtr->liveCount++;
+
+        cpuIndex = ( cpuIndex + 1 ) % runPtr->cpuCount;
+        headPtr = headPtr->nextPCB;
+    }
+
+    // order each queue
+       // function: heapifyReadyQueue
+    for( cpuIndex = 0; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        heapifyReadyQueue( &runPtr->cpus[ cpuIndex ].readyQueue );
+    }
+}
+
+/*
+Name: startProcess
+Process: binds a PCB to its run and cpu and sets it ready to dispatch 
+         at the top MLFQ level with no CFS virtual runtime, the caller 
+         queues it ready
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to PCB (PCBType *),
+                           cpu number (int)
+Function Output/Parameters: started PCB (PCBType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void startProcess( SimRunType *runPtr, PCBType *pcbPtr, int cpuID )
+{
+    pcbPtr->simRun = runPtr;
+    pcbPtr->cpuID = cpuID;
+    pcbPtr->PCBStatus = READY_STATE;
+    pcbPtr->nextTask = NULL;
+    pcbPtr->nextIO = NULL;
+    pcbPtr->queueLevel = 0;
+    pcbPtr->levelEpoch = 0;
+    pcbPtr->prevReady = NULL;
+    pcbPtr->nextReady = NULL;
+    pcbPtr->vruntime = 0;
+    pcbPtr->treeParent = NULL;
+    pcbPtr->treeLeft = NULL;
+    pcbPtr->treeRight = NULL;
+}
+
+/*
+Name: startWorkerPool
+Process: starts the worker pool of a run, sized by the config worker
+         threads, online cores if zero, and at least one worker per cpu
+         so no busy cpu waits on a worker parked in the timer; the pool
+         size does not depend on the process count, so process count is
+         bounded only by memory
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: started pool (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: sysconf, malloc, pthread_create
+*/
+void startWorkerPool( SimRunType *runPtr )
+{
+    int workerCount = runPtr->configPtr->workerThreads;
+    int workerIndex;
+
+    // set worker count to online cores as needed, within limits
+       // function: sysconf
+    if( workerCount <= 0 )
+    {
+        workerCount = (int)sysconf( _SC_NPROCESSORS_ONLN );
+    }
+
+    if( workerCount > MAX_WORKER_THREADS )
+    {
+        workerCount = MAX_WORKER_THREADS;
+    }
+
+    if( workerCount < runPtr->cpuCount )
+    {
+        workerCount = runPtr->cpuCount;
+    }
+
+    runPtr->workers = (pthread_t *)malloc( workerCount * sizeof(pthread_t) );
+    runPtr->workerCount = 0;
+
+    // start workers, they wait for dispatched tasks
+       // function: pthread_create
+    for( workerIndex = 0; workerIndex < workerCount; workerIndex++ )
+    {
+        if( pthread_create( &runPtr->workers[ workerIndex ], NULL, 
+                                        simulateWorker, (void *)runPtr ) != 0 )
+        {
+            break;
+        }
+
+        runPtr->workerCount++;
+    }
+}
+
+/*
+Name: endWorkerPool
+Process: stops the worker pool of a run and joins its threads
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: stopped pool (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_broadcast, 
+              pthread_mutex_unlock, pthread_join, free
+*/
+void endWorkerPool( SimRunType *runPtr )
+{
+    int workerIndex;
+
+    // signal stop to all workers
+       // function: pthread_mutex_lock, pthread_cond_broadcast,
+       //           pthread_mutex_unlock
+    pthread_mutex_lock( &runPtr->runMutex );
+
+    runPtr->stopFlag = true;
+    pthread_cond_broadcast( &runPtr->taskCond );
+
+    pthread_mutex_unlock( &runPtr->runMutex );
+
+    // join workers, release pool
+       // function: pthread_join, free
+    for( workerIndex = 0; workerIndex < runPtr->workerCount; workerIndex++ )
+    {
+        pthread_join( runPtr->workers[ workerIndex ], NULL );
+    }
+
+    free( runPtr->workers );
+
+    runPtr->workers = NULL;
+    runPtr->workerCount = 0;
+}
+
+/*
+Name: startDevices
+Process: sets up one device slot per argument code for runs whose 
+         policy blocks processes on I/O, the preemptive policies, so I/O
+         overlaps other processes' cpu bursts; non-preemptive policies 
+         run I/O on the cpu, no devices; each worker starts on its 
+         first request, so unused devices cost no thread
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: run devices, NULL if none (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: isPreemptivePolicy, malloc, pthread_mutex_init, 
+              pthread_cond_init
+*/
+void startDevices( SimRunType *runPtr )
+{
+    DeviceRunType *devicePtr;
+    int deviceIndex;
+
+    runPtr->devices = NULL;
+    runPtr->deviceCount = 0;
+
+    // check for I/O on the cpu
+       // function: isPreemptivePolicy
+    if( !isPreemptivePolicy( runPtr->configPtr->cpuSchedCode ) )
+    {
+        return;
+    }
+
+    // set up each device idle, worker not started
+       // function: malloc, pthread_mutex_init, pthread_cond_init
+    runPtr->devices = (DeviceRunType *)malloc( 
+                                      BAD_ARG_CODE * sizeof( DeviceRunType ) );
+
+    if( runPtr->devices == NULL )
+    {
+        return;
+    }
+
+    runPtr->deviceCount = BAD_ARG_CODE;
+
+    for( deviceIndex = 0; deviceIndex < runPtr->deviceCount; deviceIndex++ )
+    {
+        devicePtr = &runPtr->devices[ deviceIndex ];
+
+        devicePtr->deviceCode = deviceIndex;
+        devicePtr->queueHead = NULL;
+        devicePtr->queueTail = NULL;
+        devicePtr->startedFlag = false;
+        devicePtr->busyFlag = false;
+        devicePtr->stopFlag = false;
+        devicePtr->simRun = runPtr;
+
+        pthread_mutex_init( &devicePtr->deviceMutex, NULL );
+        pthread_cond_init( &devicePtr->requestCond, NULL );
+    }
+}
+
+/*
+Name: endDevices
+Process: stops and joins the device workers of a run, all idle once no
+         process is left, and releases the devices
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: cleared run devices (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_signal, 
+              pthread_mutex_unlock, pthread_join, pthread_mutex_destroy,
+              pthread_cond_destroy, free
+*/
+void endDevices( SimRunType *runPtr )
+{
+    DeviceRunType *devicePtr;
+    int deviceIndex;
+
+    for( deviceIndex = 0; deviceIndex < runPtr->deviceCount; deviceIndex++ )
+    {
+        devicePtr = &runPtr->devices[ deviceIndex ];
+
+        // stop and join started worker
+           // function: pthread_mutex_lock, pthread_cond_signal,
+           //           pthread_mutex_unlock, pthread_join
+        if( devicePtr->startedFlag )
+        {
+            pthread_mutex_lock( &devicePtr->deviceMutex );
+
+            devicePtr->stopFlag = true;
+            pthread_cond_signal( &devicePtr->requestCond );
+
+            pthread_mutex_unlock( &devicePtr->deviceMutex );
+
+            pthread_join( devicePtr->thread, NULL );
+        }
+
+           // function: pthread_mutex_destroy, pthread_cond_destroy
+        pthread_mutex_destroy( &devicePtr->deviceMutex );
+        pthread_cond_destroy( &devicePtr->requestCond );
+    }
+
+    // release devices
+       // function: free
+    free( runPtr->devices );
+
+    runPtr->devices = NULL;
+    runPtr->deviceCount = 0;
+}
+
+/*
+Name: initSimRun
+Process: sets up the shared state of a simulation run, its cpus with
+         their run queues, its devices and, in pool mode, its worker pool;
+         in coroutine mode no pool is started, each dispatcher resumes 
+         its processes itself
+Function Input/Parameters: pointer to run (SimRunType *),
+                           configuration data (ConfigDataType *),
+                           pointer to fileHolder head (logToFile *),
+                           run timer (SimTimerType *),
+                           process loader, NULL if preloaded (MetaDataStream *)
+Function Output/Parameters: initialized run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: initInterruptQueue, malloc, initReadyQueue, 
+              pthread_mutex_init, pthread_cond_init, startDevices, 
+              startWorkerPool
+*/
+void initSimRun( SimRunType *runPtr, ConfigDataType *configPtr, 
+                 logToFile *fileHolder, SimTimerType *simTimer, 
+                 MetaDataStream *streamPtr )
+{
+    int cpuIndex;
+
+    runPtr->configPtr = configPtr;
+    runPtr->fileHolder = fileHolder;
+    runPtr->simTimer = simTimer;
+    runPtr->streamPtr = streamPtr;
+    runPtr->streamFlag = streamPtr != NULL;
+    runPtr->admitFlag = false;
+    runPtr->nextPID = 0;
+    runPtr->liveCount = 0;
+    runPtr->idleCount = 0;
+    runPtr->wakeCount = 0;
+    runPtr->pendingInterrupts = 0;
+    runPtr->drainFlag = false;
+    runPtr->taskHead = NULL;
+    runPtr->taskTail = NULL;
+    runPtr->stopFlag = false;
+
+    initInterruptQueue( &runPtr->interrupts );
+
+    // set up each cpu with an empty run queue
+       // function: malloc, initReadyQueue, pthread_cond_init
+    runPtr->cpuCount = configPtr->cpuCount > 0 ? configPtr->cpuCount : 1;
+    runPtr->cpus = (CpuRunType *)malloc( 
+                                   runPtr->cpuCount * sizeof( CpuRunType ) );
+
+    for( cpuIndex = 0; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        runPtr->cpus[ cpuIndex ].cpuID = cpuIndex;
+        runPtr->cpus[ cpuIndex ].busyFlag = false;
+        runPtr->cpus[ cpuIndex ].startedFlag = true;
+        runPtr->cpus[ cpuIndex ].simRun = runPtr;
+
+        initReadyQueue( &runPtr->cpus[ cpuIndex ].readyQueue, 
+                           configPtr->cpuSchedCode, configPtr->mlfqLevels );
+        pthread_cond_init( &runPtr->cpus[ cpuIndex ].yieldCond, NULL );
+    }
+
+    pthread_mutex_init( &runPtr->runMutex, NULL );
+    pthread_cond_init( &runPtr->taskCond, NULL );
+    pthread_cond_init( &runPtr->idleCond, NULL );
+    pthread_mutex_init( &runPtr->logMutex, NULL );
+
+    // set up devices and load times
+       // function: pthread_mutex_init, startDevices
+    pthread_mutex_init( &runPtr->loadMutex, NULL );
+    runPtr->busyCpus = 0;
+    runPtr->busyDevices = 0;
+    runPtr->loadNSec = 0;
+    runPtr->cpuBusyNSec = 0;
+    runPtr->deviceBusyNSec = 0;
+    runPtr->overlapNSec = 0;
+    runPtr->boostNSec = configPtr->mlfqBoostTime * 1000000LL;
+
+    startDevices( runPtr );
+
+    // check for pool mode, start workers
+       // function: startWorkerPool
+    runPtr->coroutineFlag = configPtr->execModeCode != EXEC_POOL_CODE;
+    runPtr->workers = NULL;
+    runPtr->workerCount = 0;
+
+    if( !runPtr->coroutineFlag )
+    {
+        startWorkerPool( runPtr );
+    }
+}
+
+/*
+Name: clearSimRun
+Process: stops the worker pool and devices and releases the shared 
+         state of a finished simulation run
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: cleared run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: endWorkerPool, endDevices, clearReadyQueue, 
+              pthread_cond_destroy, free, pthread_mutex_destroy
+*/
+void clearSimRun( SimRunType *runPtr )
+{
+    int cpuIndex;
 
-   // initialize memory 
-      // function: memSim
-   memSim(NULL, logCode, dispFlag, fileHolder, START, configPtr, usedMem);
-    
-   // set all PCBs to ready
-      // function: setState
-   setState( PCBHead, READY_STATE, logCode, fileHolder, logFile );
+    endWorkerPool( runPtr );
+    endDevices( runPtr );
 
-    // set display flag to run state
-    dispFlag = RUN;
-    
-    // Start threads for each PCB (process)
-    while (PCBHeadHolder != NULL) 
-       {
-        pthread_create(&(PCBHeadHolder->PID), NULL, 
-                    simulateProcess, (void *)PCBHeadHolder );
-        PCBHeadHolder = PCBHeadHolder->nextPCB;
-       }
+    for( cpuIndex = 0; cpuIndex < runPtr->cpuCount; cpuIndex++ )
+    {
+        clearReadyQueue( &runPtr->cpus[ cpuIndex ].readyQueue );
+        pthread_cond_destroy( &runPtr->cpus[ cpuIndex ].yieldCond );
+    }
 
-    // Wait for all threads to finish
-    PCBHeadHolder = PCBHead;
-    while (PCBHeadHolder != NULL) 
-       {
-        pthread_join(PCBHeadHolder->PID, NULL);
-        PCBHeadHolder = PCBHeadHolder->nextPCB;
-       }
+    free( runPtr->cpus );
+    runPtr->cpus = NULL;
 
-    // Finish simulation 
-       // function: accessTimer
-    accessTimer(STOP_TIMER, timer);
-    snprintf(fileLine, sizeof(fileLine), "%.8s, OS: Simulation End\n", timer);
-    if (logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE) 
-       {
-        printf("%s", fileLine);
-       }
-    if (logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE)
-       {
-        fileHolder = addLine(fileHolder, fileLine);
-        dumpFile(fileHolder, logFile);
-       }
-   }
+    pthread_mutex_destroy( &runPtr->runMutex );
+    pthread_cond_destroy( &runPtr->taskCond );
+    pthread_cond_destroy( &runPtr->idleCond );
+    pthread_mutex_destroy( &runPtr->logMutex );
+    pthread_mutex_destroy( &runPtr->loadMutex );
+}
 
 /*
-Name: simulateProcess
-Process: simulates threading processes
-Function Input/Parameters: configuration data (ConfigDataType *),
-                           metadata (OpCodeType *)
+Name: logEvent
+Process: displays a time stamped line to monitor and/or file by log code;
+         file lines keep the raw time, formatted at dump
+Function Input/Parameters: pointer to run (SimRunType *),
+                           line text after the time stamp (const char *)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
-Device Output/device: none
-Dependencies: accessTimer, snprintf, printf, pthread_exit
+Device Output/device: Displays to monitor and/or file
+Dependencies: pthread_mutex_lock, lapSimTimer, nSecToString, printf, 
+              addEvent, pthread_mutex_unlock
 */
-void *simulateProcess(void *arg) 
+void logEvent( SimRunType *runPtr, const char *eventLine )
 {
-    PCBType *pcb = (PCBType *)arg;
+    int logCode = runPtr->configPtr->logToCode;
+    long long eventNSec;
     char timer[STD_STR_LEN];
-    char fileLine[256];
 
-    // Access the timer for this process
-    accessTimer(LAP_TIMER, timer);
+    // time and write line in one step so outputs stay in order
+       // function: pthread_mutex_lock, lapSimTimer
+    pthread_mutex_lock( &runPtr->logMutex );
 
-    // Simulate the process (this is a placeholder for your simulation logic)
-    printf("%s, OS: Process: %lu is simulating...\n", timer, pcb->PID);
+    eventNSec = lapSimTimer( runPtr->simTimer );
 
-    // Simulate process task completion
-    accessTimer(LAP_TIMER, timer);
-    snprintf(fileLine, sizeof(fileLine), "%.8s, OS: Process: %lu finished execution\n", timer, pcb->PID);
+    // check for monitor or both
+       // function: nSecToString, printf
+    if( logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE )
+    {
+        nSecToString( eventNSec, timer );
+        printf( "%s, %s", timer, eventLine );
+    }
 
-    // You can log this to a file or console depending on your config
-    // For now, we'll print it
-    printf("%s", fileLine);
+    // check for file or both
+       // function: addEvent
+    if( logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE )
+    {
+        runPtr->fileHolder = addEvent( runPtr->fileHolder, eventNSec, 
+                                                                eventLine );
+    }
 
-    pthread_exit(NULL);  // Exit thread when done
+       // function: pthread_mutex_unlock
+    pthread_mutex_unlock( &runPtr->logMutex );
 }
 
 
 
 /*
-Name: addLine
-Process: recursively creates new fileHolder for dumping at the end of the display
-Function Input/Parameters: pointer to fileHolder head
-
+Name: addEvent
+Process: appends a log event at the tail of the fileHolder list, keeping
+         the raw event time; the time stamp is formatted when dumped
+Function Input/Parameters: pointer to fileHolder head (logToFile *),
+                           event time in ns or NO_EVENT_TIME (long long),
+                           line text after the time stamp (const char *)
 Function Output/Parameters: none
 Function Output/Returned: returns pointer to fileHolder
 Device Input/device: none
 Device Output/device: none
-Dependencies: copyString
+Dependencies: malloc, snprintf
 */
-logToFile *addLine(logToFile *fileHolder, char *lineAdd) {
-    // Check if fileHolder is NULL
-    if (fileHolder == NULL) 
+logToFile *addEvent( logToFile *fileHolder, long long eventNSec, 
+                                                        const char *lineAdd )
+{
+    // Allocate memory for a new logToFile node
+    logToFile *newLine = (logToFile *)malloc(sizeof(logToFile));
+
+    if (newLine == NULL) 
     {
-        // Allocate memory for a new logToFile node
-        fileHolder = (logToFile *)malloc(sizeof(logToFile));
-        if (fileHolder == NULL) 
-        {
-            printf("Memory allocation failed\n");
-            return NULL;  // Return if memory allocation fails
-        }
+        printf("Memory allocation failed\n");
+        return fileHolder;  // Return if memory allocation fails
+    }
+
+    // Copy the event time and line text, bounded to the line size
+    newLine->eventNSec = eventNSec;
+    snprintf(newLine->filePiece, sizeof(newLine->filePiece), "%s", lineAdd);
+    newLine->next = NULL;
+    newLine->tail = NULL;
 
-        // Copy the line to filePiece using the copyString function
-        copyString(fileHolder->filePiece, lineAdd);
+    // Check if fileHolder is NULL, new line is the head
+    if (fileHolder == NULL) 
+    {
+        newLine->tail = newLine;
 
-        // Initialize next pointer
-        fileHolder->next = NULL;
+        return newLine;
+    }
 
-        return fileHolder;  // Return the newly created node
+    // Link after the tail held on the head
+    if (fileHolder->tail == NULL)
+    {
+        fileHolder->tail = fileHolder;
     }
 
-    // Recursively add the line to the next node
-    fileHolder->next = addLine(fileHolder->next, lineAdd);
+    fileHolder->tail->next = newLine;
+    fileHolder->tail = newLine;
 
     return fileHolder;
 }
 
+/*
+Name: addLine
+Process: appends a preformatted line for dumping at the end of the display
+Function Input/Parameters: pointer to fileHolder head (logToFile *),
+                           string to add (char *)
+Function Output/Parameters: none
+Function Output/Returned: returns pointer to fileHolder
+Device Input/device: none
+Device Output/device: none
+Dependencies: addEvent
+*/
+logToFile *addLine(logToFile *fileHolder, char *lineAdd) 
+{
+    return addEvent(fileHolder, NO_EVENT_TIME, lineAdd);
+}
+
 
 /*
 Name: addPCB
-Process: recursively creates new PCB with data from the config & metadata files
+Process: creates a new PCB from a process index entry; run time and cpu
+         cycles come from the entry so no ops are walked, and the PCB is
+         linked after the given tail so list building is linear
 Function Input/Parameters: pointer to config data structure (ConfigDataType *)
-                           Pointer to metadata structure (OpCodeType *)
-                           pointer to PCB head (PCBType *)
+                           pointer to process index entry (ProcessIndexType *)
+                           PID (int)
+                           pointer to tail PCB, NULL for none (PCBType *)
 Function Output/Parameters: none
-Function Output/Returned: returns pointer to PCB head
+Function Output/Returned: returns pointer to new PCB
 Device Input/device: none
 Device Output/device: none
-Dependencies: tbd
+Dependencies: malloc, calculateOpTime, nextOpCode
 */
-PCBType *addPCB( ConfigDataType *configDataPtr, OpCodeType *metaDataPtr, int PID,
-                                                         PCBType *PCBHeadPtr)
+PCBType *addPCB( ConfigDataType *configDataPtr, ProcessIndexType *procPtr, 
+                                               int PID, PCBType *PCBTailPtr )
 {
-    int endTime = calculateOpTime(metaDataPtr, configDataPtr);
-    PCBType *tempHolder;
-    
-    //check if PCB head is null
-    if( PCBHeadPtr == NULL)
-    {
-        //allocate the data
-        PCBHeadPtr = (PCBType *)malloc(sizeof(PCBType));
-        //set status new
-        PCBHeadPtr->PCBStatus = NEW_STATE;
-        //set the appstart
-        PCBHeadPtr->appStart = metaDataPtr;
-        //set next to null
-        PCBHeadPtr->nextPCB = NULL;
-        //calculate op time
-        PCBHeadPtr->opEndTime = endTime;
-        
-        PCBHeadPtr->PID = PID;
-        
-        //return head
-        return PCBHeadPtr;
-    }
-    
-    if(configDataPtr->cpuSchedCode == CPU_SCHED_SJF_N_CODE || 
-                    configDataPtr->cpuSchedCode == CPU_SCHED_SRTF_P_CODE)
+    //allocate the data
+    PCBType *newPCB = (PCBType *)malloc(sizeof(PCBType));
+
+    //set status new
+    newPCB->PCBStatus = NEW_STATE;
+    //set the appstart and index entry
+    newPCB->appStart = procPtr->appStart;
+    newPCB->procInfo = *procPtr;
+    //set next to null, run set when the run starts it
+    newPCB->nextPCB = NULL;
+    newPCB->simRun = NULL;
+    newPCB->nextTask = NULL;
+    //calculate op time
+    newPCB->opEndTime = calculateOpTime(procPtr, configDataPtr);
+    //set remaining cycles and io time
+    newPCB->cycles = procPtr->cpuCycles;
+    newPCB->ioTime = procPtr->ioCycles * configDataPtr->ioCycleRate;
+    //set program counter to first op, all run time left
+    newPCB->currentOp = nextOpCode( procPtr->appStart );
+    newPCB->opCyclesLeft = 0;
+    newPCB->queueIndex = NO_QUEUE_INDEX;
+    newPCB->timeLeft = newPCB->opEndTime;
+
+    newPCB->PID = PID;
+
+    //link after tail
+    if( PCBTailPtr != NULL )
     {
-        if(endTime < PCBHeadPtr->opEndTime)
-        {
-            //set new data
-            tempHolder = (PCBType *)malloc(sizeof(PCBType));
-            tempHolder->PCBStatus = NEW_STATE;
-            tempHolder->appStart = metaDataPtr;
-            tempHolder->opEndTime = endTime;
-
-            //set current PTR to the next because it is bigger
-            tempHolder->nextPCB = PCBHeadPtr;
-            //give the smaller PID to the new block
-            tempHolder->PID = PCBHeadPtr->PID;
-            //update the old ID to be more
-            PCBHeadPtr->PID = PID;
-            //return the new PTR
-            return tempHolder;
-        }
+        PCBTailPtr->nextPCB = newPCB;
     }
 
-    //set head next to recusive call with next
-    PCBHeadPtr->nextPCB = addPCB( configDataPtr, metaDataPtr, PID,
-                                                        PCBHeadPtr->nextPCB);
-
-    //return head
-    return PCBHeadPtr;
+    //return new PCB
+    return newPCB;
 }
 
 
 /*
 Name: startPCB
-Process: starts building the PCB 
-Function Input/Pananeters: configuration data (ConfigDataType *),
-                           metadata (OpCodeType *)
+Process: builds the PCB list from the process index in one pass,
+         PIDs follow metadata order; policy order is left to the 
+         ready queue
+Function Input/Pananeters: process index (ProcessIndexTable *),
+                           configuration data (ConfigDataType *)
 Function Output/Parameters: none
 Function Output/Returned: pointer to head of PCB Linked list
 Device Input/device: none
 Device Output/device: none
 Dependencies: addPCB
 */
-PCBType *startPCB(OpCodeType *metaDataPtr, ConfigDataType *configPtr)
+PCBType *startPCB( ProcessIndexTable *indexPtr, ConfigDataType *configPtr )
 {
-    PCBType *PCBHead = NULL;
-    int PID = 0;
+    PCBType *PCBHead = NULL, *PCBTail = NULL;
+    int PID;
     
-    //loop over temp metadata until end of data
-    while( metaDataPtr != NULL)
+    //check for no processes
+    if( indexPtr->count == 0 )
     {
-        //look for metaData app start
-        if( compareString(metaDataPtr->command, "app") == STR_EQ &&
-           compareString(metaDataPtr->strArg1, "start") == STR_EQ )
-        {
-            //add to PCB
-            PCBHead =  addPCB( configPtr, metaDataPtr, PID, PCBHead);
+        return NULL;
+    }
 
-            PID++;
+    //loop over index entries, appending to tail
+    for( PID = 0; PID < indexPtr->count; PID++ )
+    {
+        PCBTail = addPCB( configPtr, &indexPtr->procs[ PID ], PID, PCBTail );
 
+        if( PCBHead == NULL )
+        {
+            PCBHead = PCBTail;
         }
-        
-        //move meta data
-        metaDataPtr = metaDataPtr->nextNode;
     }
-    
+
     return PCBHead;
 }
 
-pthread_mutex_t stateMutex = PTHREAD_MUTEX_INITIALIZER;
-
-
 /*
 Name: setState
 Process: loops over the PCB list setting the state and displaying appropriately
@@ -287,7 +2149,7 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: Displays to monitor and/or file
-Dependencies: accessTimer
+Dependencies: currentSimTimer, lapSimTimer, nSecToString, addEvent
 */
 pthread_mutex_t stateMutex = PTHREAD_MUTEX_INITIALIZER;
 
@@ -298,6 +2160,7 @@ void setState(PCBType *headPtr, int state, int logCode,
     PCBType *pcbHolder = headPtr;
     char timer[STD_STR_LEN];
     char fileLine[256];
+    long long eventNSec;
     
     // check for holder not null
     while(pcbHolder != NULL)
@@ -309,15 +2172,16 @@ void setState(PCBType *headPtr, int state, int logCode,
 
         pthread_mutex_unlock( &stateMutex);
 
-        // lap timer
-           // function: accessTimer
-        accessTimer(LAP_TIMER, timer);
+        // lap timer, raw time formatted only for output
+           // function: currentSimTimer, lapSimTimer
+        eventNSec = lapSimTimer( currentSimTimer() );
         
         // check for monitor or both
         if(logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE)
            {
             // print process and remaining time
-               // function: printf
+               // function: nSecToString, printf
+            nSecToString(eventNSec, timer);
             printf("%s, OS: Process: %lu set to READY state from NEW state\n",
                                                         timer, pcbHolder->PID);
            }
@@ -326,12 +2190,12 @@ void setState(PCBType *headPtr, int state, int logCode,
         if(logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE)
         {
 
-            // print to file 
-               // function: printf
-            snprintf(fileLine, STD_STR_LEN, "%.8s, OS: Process: %lu set to READY state from NEW state\n", 
-                        timer, pcbHolder->PID);
+            // log event, time stamp formatted at dump
+               // function: snprintf, addEvent
+            snprintf(fileLine, STD_STR_LEN, "OS: Process: %lu set to READY state from NEW state\n", 
+                        pcbHolder->PID);
             
-            fileHolder = addLine(fileHolder, fileLine);
+            fileHolder = addEvent(fileHolder, eventNSec, fileLine);
 
         }
         
@@ -416,14 +2280,25 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: none
-Dependencies: fprintf
+Dependencies: nSecToString, fprintf
 */
 void dumpFile( logToFile *fileHolder, FILE *fileName )
 {
     logToFile *tempPtr = fileHolder;
+    char timer[STD_STR_LEN];
+
     while( tempPtr != NULL )
        {
-        fprintf(fileName, "%s", tempPtr->filePiece);
+        // format time stamp for timed events only
+        if( tempPtr->eventNSec != NO_EVENT_TIME )
+           {
+            nSecToString(tempPtr->eventNSec, timer);
+            fprintf(fileName, "%s, %s", timer, tempPtr->filePiece);
+           }
+        else
+           {
+            fprintf(fileName, "%s", tempPtr->filePiece);
+           }
         tempPtr = tempPtr->next;
        }
 }
@@ -437,21 +2312,22 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: none
-Dependencies: fprintf
+Dependencies: currentSimTimer, lapSimTimer, nSecToString, printf, addEvent
 */
 void checkIdle( PCBType *pcbPtr, logToFile *fileHolder, char *timer, int logCode )
    {
     PCBType *nextPtr = NULL;
-    char fileLine[STD_STR_LEN];
+    long long eventNSec;
     if(pcbPtr->nextPCB != NULL)
        {
         nextPtr = pcbPtr->nextPCB;
         if(pcbPtr->PCBStatus != BLOCKED_STATE && nextPtr->PCBStatus == BLOCKED_STATE)
            {
-            accessTimer(LAP_TIMER, timer);
+            eventNSec = lapSimTimer( currentSimTimer() );
             if(logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE)
                {
                 //print process and remaining time
+                nSecToString(eventNSec, timer);
                 printf("%s, OS: CPU idle, all active processes blocked\n", timer);
 
                 printf("%s, OS: CPU interrupt, end idle\n", timer);
@@ -460,14 +2336,10 @@ void checkIdle( PCBType *pcbPtr, logToFile *fileHolder, char *timer, int logCode
             //check for file or both
             if(logCode == LOGTO_FILE_CODE || logCode == LOGTO_BOTH_CODE)
                {
-                //print to file
-                snprintf(fileLine, STD_STR_LEN, "%.8s, OS: CPU idle, all active processes blocked\n", timer);
-
-                fileHolder = addLine(fileHolder, fileLine);
-
-                snprintf(fileLine, STD_STR_LEN, "%.8s, OS: CPU interrupt, end idle\n", timer);
+                //log events, time stamps formatted at dump
+                fileHolder = addEvent(fileHolder, eventNSec, "OS: CPU idle, all active processes blocked\n");
 
-                fileHolder = addLine(fileHolder, fileLine);
+                fileHolder = addEvent(fileHolder, eventNSec, "OS: CPU interrupt, end idle\n");
                }
            }
        }
@@ -475,45 +2347,111 @@ void checkIdle( PCBType *pcbPtr, logToFile *fileHolder, char *timer, int logCode
 
 /*
 Name: calculateOpTime
-Process: Calculate Process time for PCB process
-Function Input/Parameters: pointer to metadata app start head (OpCpdeType *)
+Process: Calculate Process time for PCB process from its index entry,
+         cycle totals times config cycle rates, constant time
+Function Input/Parameters: pointer to process index entry (const ProcessIndexType *)
                            Pointer to config head (configDataType *)
 Function Output/Parameters: none
 Function Output/Returned: Total calculated operation time
 Device Input/device: none
 Device Output/device: none
-Dependencies: accessTimer
+Dependencies: none
 */
-int calculateOpTime(OpCodeType *MDPtr, ConfigDataType *configPtr)
+int calculateOpTime( const ProcessIndexType *procPtr, 
+                                                ConfigDataType *configPtr )
    {
-    //init vars
-    int runTime = 0;
-    OpCodeType *tempPtr = MDPtr->nextNode;
-    
-    // loop through
-    while(tempPtr != NULL && (compareString(tempPtr->command,"app") != STR_EQ))
+    //return total of cpu and io time
+    return procPtr->cpuCycles * configPtr->proCycleRate
+                                + procPtr->ioCycles * configPtr->ioCycleRate;
+   }
+
+/*
+Name: decodeMetaData
+Process: decode stage, resolves each op into its decoded operation
+         and precomputes cpu and I/O op times from the config cycle rates
+Function Input/Parameters: pointer to metadata head (OpCodeType *)
+                           Pointer to config head (configDataType *)
+Function Output/Parameters: decoded metadata (OpCodeType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: decodeOpKind, nextOpCode
+*/
+void decodeMetaData( OpCodeType *metaDataPtr, ConfigDataType *configPtr )
+   {
+    // loop across all ops
+    while( metaDataPtr != NULL )
        {
-        // check for cpu run time
-        if(compareString(tempPtr->command, "cpu") == STR_EQ)
-           {
-            // calc run time
-            runTime = runTime + ((tempPtr->intArg2) * 
-                                                    ( configPtr->proCycleRate ));
-           }
+        // resolve decoded operation
+           // function: decodeOpKind
+        metaDataPtr->opKind = (unsigned char)decodeOpKind( metaDataPtr );
 
-        // check for dev run time
-        if( compareString ( tempPtr->command, "dev" ) == STR_EQ )
+        // set op time by operation
+        switch( metaDataPtr->opKind )
            {
-            // calc run time
-            runTime = runTime + (( tempPtr->intArg2 ) * ( configPtr->ioCycleRate ));
+            case CPU_PROCESS_OP:
+
+               metaDataPtr->opTime 
+                              = metaDataPtr->intArg2 * configPtr->proCycleRate;
+               break;
+
+            case DEV_IN_OP:
+            case DEV_OUT_OP:
+
+               metaDataPtr->opTime 
+                               = metaDataPtr->intArg2 * configPtr->ioCycleRate;
+               break;
+
+            default:
+
+               metaDataPtr->opTime = 0;
+               break;
            }
 
-        // update tempPtr
-        tempPtr = tempPtr->nextNode;
+        // update metadata pointer
+        metaDataPtr = nextOpCode( metaDataPtr );
        }
-    
-    //return total
-    return runTime;
+   }
+
+/*
+Name: decodeOpKind
+Process: resolves an op command and first argument to a decoded operation
+Function Input/Parameters: pointer to op code (const OpCodeType *)
+Function Output/Parameters: none
+Function Output/Returned: decoded operation (OpDecodeCodes)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+OpDecodeCodes decodeOpKind( const OpCodeType *opPtr )
+   {
+    // decode by command, then argument
+    switch( opPtr->command )
+       {
+        case SYS_CMD_CODE:
+
+           return opPtr->strArg1 == START_ARG_CODE ? SYS_START_OP : SYS_END_OP;
+
+        case APP_CMD_CODE:
+
+           return opPtr->strArg1 == START_ARG_CODE ? APP_START_OP : APP_END_OP;
+
+        case CPU_CMD_CODE:
+
+           return CPU_PROCESS_OP;
+
+        case DEV_CMD_CODE:
+
+           return opPtr->inOutArg == IN_IO_CODE ? DEV_IN_OP : DEV_OUT_OP;
+
+        case MEM_CMD_CODE:
+
+           return opPtr->strArg1 == ACCESS_ARG_CODE 
+                                             ? MEM_ACCESS_OP : MEM_ALLOCATE_OP;
+       }
+
+    // return undecoded for unknown command
+    return UNDECODED_OP;
    }
 
 /*
@@ -532,7 +2470,16 @@ PCBType *addfromPCB( PCBType *pcbPtr, int state )
     PCBType *newPCB = malloc(sizeof(PCBType));
     
     newPCB->appStart = pcbPtr->appStart;
+    newPCB->procInfo = pcbPtr->procInfo;
     newPCB->opEndTime = pcbPtr->opEndTime;
+    newPCB->cycles = pcbPtr->cycles;
+    newPCB->ioTime = pcbPtr->ioTime;
+    newPCB->timeLeft = pcbPtr->timeLeft;
+    newPCB->currentOp = pcbPtr->currentOp;
+    newPCB->opCyclesLeft = pcbPtr->opCyclesLeft;
+    newPCB->queueIndex = NO_QUEUE_INDEX;
+    newPCB->simRun = pcbPtr->simRun;
+    newPCB->nextTask = NULL;
     newPCB->PCBStatus = state;
     newPCB->PID = pcbPtr->PID;
     newPCB->nextPCB = NULL;
@@ -606,7 +2553,7 @@ bool memSim( OpCodeType *memPtr, int logCode, int PID, logToFile *fileHolder,
     if( flag == RUN )
        {
         dataEdge = memPtr->intArg2 + memPtr->intArg3 - 1;
-        if( compareString(memPtr->strArg1, "access") == STR_EQ )
+        if( memPtr->opKind == MEM_ACCESS_OP )
            {
             while( tempMem->next != NULL && memAcq != true )
                {
@@ -660,7 +2607,7 @@ bool memSim( OpCodeType *memPtr, int logCode, int PID, logToFile *fileHolder,
         }
         if(memAcq)
         {  
-            if(compareString(memPtr->strArg1, "access") == STR_EQ)
+            if(memPtr->opKind == MEM_ACCESS_OP)
             {
                 //check for monitor or both
                 if(logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE)
@@ -724,7 +2671,7 @@ bool memSim( OpCodeType *memPtr, int logCode, int PID, logToFile *fileHolder,
         }
         else
         {
-            if(compareString(memPtr->strArg1, "access") == STR_EQ)
+            if(memPtr->opKind == MEM_ACCESS_OP)
             {
                 if(logCode == LOGTO_MONITOR_CODE || logCode == LOGTO_BOTH_CODE)
                 {
@@ -860,7 +2807,7 @@ memHolder *addMem(memHolder *usedMem, int startData, int endData)
     }
     
     //set head next to recusive call with next
-    usedMem->next= addMem(usedMem, startData, endData);
+    usedMem->next= addMem(usedMem->next, startData, endData);
     
     //return head
     return usedMem;
@@ -890,217 +2837,3 @@ memHolder *freeMem(memHolder *usedMem)
     return NULL;
 }
 
-
-/*
-Name: enqueueInterrupt
-Process: Recursively frees used memory
-Function Input/Pananeters: memHolder * (pointer to used memory)
-Function Output/Parameters: none
-Function Output/Returned: none
-Device Input/device: none
-Device Output/device: none
-Dependencies: free
-*/
-void enqueueInterrupt( int processID ) 
-   {
-    pthread_mutex_lock( &interruptMutex );
-    Interrupt *newInterrupt = ( Interrupt * )malloc( sizeof( Interrupt ) );
-    newInterrupt->processID = processID;
-    newInterrupt->next = NULL;
-
-    if ( interruptQueue == NULL ) 
-       {
-        interruptQueue = newInterrupt;
-       } 
-    else 
-       {
-        Interrupt *temp = interruptQueue;
-        while ( temp->next != NULL ) 
-           {
-            temp = temp->next;
-           }
-        temp->next = newInterrupt;
-       }
-    pthread_mutex_unlock( &interruptMutex );
-}
-
-
-/*
-Name: dequeueInterrupt
-Process: Recursively frees used memory
-Function Input/Pananeters: memHolder * (pointer to used memory)
-Function Output/Parameters: none
-Function Output/Returned: none
-Device Input/device: none
-Device Output/device: none
-Dependencies: free
-*/
-int dequeueInterrupt() 
-   {
-    pthread_mutex_lock( &interruptMutex );
-    if (interruptQueue == NULL) 
-       {
-        pthread_mutex_unlock(&interruptMutex);
-        return -1;
-       }
-
-    Interrupt *temp = interruptQueue;
-    int processID = temp->processID;
-    interruptQueue = interruptQueue->next;
-    free(temp);
-    pthread_mutex_unlock(&interruptMutex);
-    return processID;
-}
-
-
-/*
-Name: simulateIO
-Process: Recursively frees used memory
-Function Input/Pananeters: memHolder * (pointer to used memory)
-Function Output/Parameters: none
-Function Output/Returned: none
-Device Input/device: none
-Device Output/device: none
-Dependencies: free
-*/
-// Function to simulate I/O operation
-void *simulateIO(void *arg) 
-   {
-    PCBType *pcb = (PCBType *)arg;
-    char timer[STD_STR_LEN];
-    accessTimer(LAP_TIMER, timer);
-    printf("%s, OS: Process %lu performing I/O operation\n", 
-                                timer, pcb->PID);
-
-    // Simulate I/O time
-    runTimer(pcb->ioTime);
-
-    // Add to interrupt queue when done
-    enqueueInterrupt(pcb->PID);
-    accessTimer(LAP_TIMER, timer);
-    printf("%s, OS: Process %lu completed I/O\n", timer, pcb->PID);
-
-    pthread_exit(NULL);
-}
-
-
-/*
-Name: scheduleProcesses
-Process: Recursively frees used memory
-Function Input/Pananeters: memHolder * (pointer to used memory)
-Function Output/Parameters: none
-Function Output/Returned: none
-Device Input/device: none
-Device Output/device: none
-Dependencies: free
-*/
-// Preemptive scheduling: FCFS-P, SRTF-P, RR-P
-void scheduleProcesses(ConfigDataType *config, PCBType **readyQueue, int schedulingCode) 
-   {
-    PCBType *current = NULL;
-    char timer[STD_STR_LEN];
-
-    while (*readyQueue != NULL) 
-       {
-        // Select process based on scheduling strategy
-        if (schedulingCode == CPU_SCHED_FCFS_P_CODE) 
-           {
-            // First Come First Serve (Preemptive)
-            current = *readyQueue;
-           } 
-        else if (schedulingCode == CPU_SCHED_SRTF_P_CODE) 
-           {
-            // Shortest Remaining Time First (Preemptive)
-            current = *readyQueue;
-            PCBType *temp = current->nextPCB;
-            while (temp != NULL) 
-               {
-                if (temp->cycles < current->cycles) 
-                   {
-                    current = temp;
-                   }
-                temp = temp->nextPCB;
-               }
-           } 
-        else if (schedulingCode == CPU_SCHED_RR_P_CODE) 
-           {
-            // Round Robin (Preemptive)
-            current = *readyQueue;  // Take the first process in the queue
-           }
-
-        // Remove the selected process from the ready queue
-        *readyQueue = current->nextPCB;
-        current->nextPCB = NULL;
-
-        // Run the selected process
-        current->PCBStatus = RUNNING_STATE;
-        accessTimer(LAP_TIMER, timer);
-        printf("%s, OS: Process %lu moved to RUNNING state\n", timer, current->PID);
-
-        int remainingCycles = current->cycles;
-        int quantum = config->quantumCycles;  // Use quantum time for Round Robin
-        bool processCompleted = false;
-
-
-        while (remainingCycles > 0) 
-           {
-            int cyclesToRun = (schedulingCode == CPU_SCHED_RR_P_CODE && remainingCycles > quantum)
-                                  ? quantum
-                                  : remainingCycles;
-
-            for (int cycle = 0; cycle < cyclesToRun; cycle++) 
-               {
-                runTimer(config->proCycleRate);
-
-                // Check for interrupts
-                int interruptID;
-                while ((interruptID = dequeueInterrupt()) != -1) 
-                   {
-                    printf("%s, OS: Process %d interrupted\n", timer, interruptID);
-                    // Handle interrupts (e.g., move interrupted process back to READY state)
-                   }
-               }
-
-            remainingCycles -= cyclesToRun;
-
-            // If preempted (RR-P or interrupt), move process back to the ready queue
-            if (remainingCycles > 0 && schedulingCode == CPU_SCHED_RR_P_CODE) 
-               {
-                current->cycles = remainingCycles;
-                current->PCBStatus = READY_STATE;
-                accessTimer(LAP_TIMER, timer);
-                printf("%s, OS: Process %lu preempted, %d cycles remaining\n", 
-                                        timer, current->PID, remainingCycles);
-
-                // Add process back to the ready queue
-                PCBType *tempQueue = *readyQueue;
-                if (tempQueue == NULL) 
-                   {
-                    *readyQueue = current;
-                   } 
-                else 
-                   {
-                    while (tempQueue->nextPCB != NULL) 
-                       {
-                        tempQueue = tempQueue->nextPCB;
-                       }
-                    tempQueue->nextPCB = current;
-                   }
-
-                // Exit inner loop by setting a flag
-                processCompleted = true;
-               }
-           }
-
-        if (remainingCycles <= 0) 
-           {
-            // Process completes execution
-            current->PCBStatus = EXIT_STATE;
-            accessTimer(LAP_TIMER, timer);
-            printf("%s, OS: Process %lu moved to EXIT state\n", 
-                                        timer, current->PID);
-           }
-       }
-    }
-
-
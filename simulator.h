@@ -3,6 +3,7 @@
 
 #include "configops.h"  
 #include "metadataops.h"
+#include "schedops.h"
 #include "simtimer.h"
 #include "OS_SimDriver.h" 
 #include "StandardConstants.h"
@@ -19,15 +20,38 @@
 
 #define START 0  // Start flag
 #define RUN 1    // Run flag
+#define CLEAR 2  // Clear flag
 typedef int Boolean;   // Define Boolean as an integer type
 
 typedef struct PCBType
 {
     pthread_t PID;  // Process ID (int)
-    pthread_t thread;  // Thread handle (pthread_t)
     int PCBStatus;  // PCB state
-    int opEndTime;  // Operation end time
+    int opEndTime;  // Total run time (ms)
+    int cycles;  // Remaining cpu cycles, counted down as they run
+    int ioTime;  // I/O time (ms)
+    int timeLeft;  // Remaining run time (ms)
+    ProcessIndexType procInfo;  // Load time process summary
     OpCodeType *appStart;  // Pointer to process start
+    OpCodeType *currentOp;  // Next op to run, the process program counter
+    int opCyclesLeft;  // Cycles left of a preempted cpu op, 0 if not started
+    long long queueKey;  // Ready queue policy key
+    long long queueOrder;  // Ready queue order, breaks key ties
+    int queueIndex;  // Ready queue heap position, -1 if not queued
+    int queueLevel;  // MLFQ level, 0 the highest
+    int levelEpoch;  // MLFQ boost epoch the level was set in
+    struct PCBType *prevReady;  // MLFQ level list neighbors
+    struct PCBType *nextReady;
+    long long vruntime;  // CFS virtual runtime, cpu cycles run
+    struct PCBType *treeParent;  // CFS red-black tree links
+    struct PCBType *treeLeft;
+    struct PCBType *treeRight;
+    bool treeRed;
+    int cpuID;  // Simulated cpu whose run queue holds the PCB
+    Interrupt ioInterrupt;  // I/O completion, one outstanding per process
+    struct SimRunType *simRun;  // Owning simulation run
+    struct PCBType *nextTask;  // Next dispatched PCB waiting for a worker
+    struct PCBType *nextIO;  // Next blocked PCB waiting on the same device
     struct PCBType *nextPCB;  // Pointer to next PCB
 } PCBType;
 
@@ -39,79 +63,365 @@ typedef struct memHolder {
 } memHolder;
 
 
+// Log event time for lines written without a time stamp
+#define NO_EVENT_TIME -1
+
 typedef struct logToFile
 {
+    long long eventNSec;          // Raw event time (ns), formatted at dump
     char filePiece[STD_STR_LEN];  // Holds a line of the log to be written to file
     struct logToFile *next;       // Pointer to the next log entry
+    struct logToFile *tail;       // Last log entry, kept on the head only
 } logToFile;
 
-// Global mutex for synchronization
-pthread_mutex_t stateMutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t interruptMutex = PTHREAD_MUTEX_INITIALIZER;
+// Upper limit on pool worker threads per run
+#define MAX_WORKER_THREADS 1024
+
+// One simulated I/O device: its service queue of blocked processes, in
+// request order, drained by its own device worker, which holds the run
+// timer while it has requests
+typedef struct DeviceRunType
+{
+    int deviceCode;  // Device argument code, its index in the run devices
+    PCBType *queueHead;  // Blocked processes waiting for this device
+    PCBType *queueTail;  // Last blocked process waiting
+    pthread_t thread;  // Device worker thread, started on first request
+    bool startedFlag;  // Device worker running
+    bool busyFlag;  // Device worker has requests, timer held for it
+    bool stopFlag;  // Tells the device worker to exit
+    pthread_mutex_t deviceMutex;  // Guards the service queue and flags
+    pthread_cond_t requestCond;  // Signals the device worker on request or stop
+    struct SimRunType *simRun;  // Owning simulation run
+} DeviceRunType;
+
+// One simulated cpu: its run queue and its dispatcher's yield signal
+typedef struct CpuRunType
+{
+    int cpuID;  // Cpu number, 0 runs on the calling thread
+    ReadyQueueType readyQueue;  // Ready processes on this cpu
+    pthread_t thread;  // Dispatcher thread, cpus other than 0
+    bool startedFlag;  // Dispatcher running, else its queue is stolen
+    bool busyFlag;  // Queue root handed to the pool, not stealable
+    pthread_cond_t yieldCond;  // Signals the dispatcher on process yield
+    struct SimRunType *simRun;  // Owning simulation run
+} CpuRunType;
+
+// One simulation run, shared by its cpu dispatchers and worker pool; a
+// dispatcher hands a running process to the pool as a task and takes
+// it back on yield; run queues, task hand off and idle cpus are all
+// guarded by runMutex, except interrupts and the counts devices read,
+// which are atomic; each device guards its own service queue
+typedef struct SimRunType
+{
+    ConfigDataType *configPtr;  // Run configuration
+    logToFile *fileHolder;  // Log lines for the file
+    struct SimTimerType *simTimer;  // Run timer
+    CpuRunType *cpus;  // Simulated cpus
+    int cpuCount;  // Simulated cpu count
+    int liveCount;  // Processes queued or running, not yet exited
+    int idleCount;  // Cpus waiting for work, not holding the timer
+    int wakeCount;  // Idle cpus woken, timer already held for them
+    InterruptQueueType interrupts;  // I/O completions, pushed lock free
+    int pendingInterrupts;  // Interrupts pushed and not yet drained
+    bool drainFlag;  // A cpu is draining interrupts
+    MetaDataStream *streamPtr;  // Process loader, NULL once loaded
+    bool streamFlag;  // Processes streamed, released at exit
+    bool admitFlag;  // A cpu is admitting streamed processes
+    int nextPID;  // PID for the next streamed process
+    bool coroutineFlag;  // Processes resumed by their dispatcher, no pool
+    pthread_t *workers;  // Worker pool threads
+    int workerCount;  // Worker pool size
+    PCBType *taskHead;  // Dispatched processes waiting for a worker
+    PCBType *taskTail;  // Last dispatched process waiting
+    bool stopFlag;  // Tells the worker pool to exit
+    pthread_mutex_t runMutex;  // Guards run queues and task hand off
+    pthread_cond_t taskCond;  // Signals the worker pool on dispatch or stop
+    pthread_cond_t idleCond;  // Signals idle cpus on new work or run end
+    pthread_mutex_t logMutex;  // Keeps monitor and file lines in order
+    DeviceRunType *devices;  // Devices by argument code, NULL if I/O runs on the cpu
+    int deviceCount;  // Device slots, one per argument code
+    pthread_mutex_t loadMutex;  // Guards the cpu and device load times
+    int busyCpus;  // Cpus running a process
+    int busyDevices;  // Devices servicing a request
+    long long loadNSec;  // Run time of the last load change
+    long long cpuBusyNSec;  // Time spent running processes, summed over cpus
+    long long deviceBusyNSec;  // Time any device was servicing a request
+    long long overlapNSec;  // Time a cpu and a device were both busy
+    long long boostNSec;  // Run time of the next MLFQ priority boost
+} SimRunType;
 
-// Interrupt queue for managing I/O completion
-typedef struct Interrupt {
-    int processID;
-    struct Interrupt *next;
-} Interrupt;
+// Global mutex for synchronization, defined in simulator.c
+extern pthread_mutex_t stateMutex;
 
 // Function Prototypes
 
+/*
+Name: addEvent
+Process: appends a log event at the tail of the fileHolder list, keeping
+         the raw event time; the time stamp is formatted when dumped
+Function Input/Parameters: pointer to fileHolder head (logToFile *),
+                           event time in ns or NO_EVENT_TIME (long long),
+                           line text after the time stamp (const char *)
+Function Output/Parameters: none
+Function Output/Returned: returns pointer to fileHolder
+Device Input/device: none
+Device Output/device: none
+Dependencies: malloc, snprintf
+*/
+logToFile *addEvent( logToFile *fileHolder, long long eventNSec, 
+                                                       const char *lineAdd );
+
 /*
 Name: addLine
-Process: recursively creates new fileHolder for dumping at the end of the display
+Process: appends a preformatted line for dumping at the end of the display
 Function Input/Parameters: pointer to fileHolder head (logToFile *),
                            string to add (char *)
 Function Output/Parameters: none
 Function Output/Returned: returns pointer to fileHolder
 Device Input/device: none
 Device Output/device: none
-Dependencies: copyString
+Dependencies: addEvent
 */
 logToFile *addLine(logToFile *fileHolder, char *lineAdd);
 
 /*
 Name: addPCB
-Process: recursively creates new PCB with data from the config & metadata files
+Process: creates a new PCB from a process index entry, linked after the 
+         given tail PCB
 Function Input/Parameters: pointer to config data structure (ConfigDataType *),
-                           pointer to metadata structure (OpCodeType *),
+                           pointer to process index entry (ProcessIndexType *),
                            PID (int),
-                           pointer to PCB head (PCBType *)
+                           pointer to tail PCB, NULL for none (PCBType *)
 Function Output/Parameters: none
-Function Output/Returned: returns pointer to PCB head
+Function Output/Returned: returns pointer to new PCB
 Device Input/device: none
 Device Output/device: none
-Dependencies: tbd
+Dependencies: malloc, calculateOpTime
 */
-PCBType *addPCB( ConfigDataType *configDataPtr, OpCodeType *metaDataPtr, int PID,
-                 PCBType *PCBHeadPtr );
+PCBType *addPCB( ConfigDataType *configDataPtr, ProcessIndexType *procPtr, 
+                 int PID, PCBType *PCBTailPtr );
 
 /*
 Name: calculateOpTime
-Process: Calculate process time for PCB process
-Function Input/Parameters: pointer to metadata app start head (OpCodeType *),
+Process: Calculate process time for PCB process from its index entry
+Function Input/Parameters: pointer to process index entry (const ProcessIndexType *),
                            pointer to config head (ConfigDataType *)
 Function Output/Parameters: none
 Function Output/Returned: Total calculated operation time
 Device Input/device: none
 Device Output/device: none
-Dependencies: accessTimer
+Dependencies: none
+*/
+int calculateOpTime( const ProcessIndexType *procPtr, 
+                                               ConfigDataType *configPtr );
+
+/*
+Name: decodeMetaData
+Process: decode stage, resolves each op into its decoded operation
+         and precomputed run time so the simulation does no string
+         or argument work per op
+Function Input/Parameters: pointer to metadata head (OpCodeType *),
+                           pointer to config data (ConfigDataType *)
+Function Output/Parameters: decoded metadata (OpCodeType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: decodeOpKind
+*/
+void decodeMetaData( OpCodeType *metaDataPtr, ConfigDataType *configPtr );
+
+/*
+Name: decodeOpKind
+Process: resolves an op command and first argument to a decoded operation
+Function Input/Parameters: pointer to op code (const OpCodeType *)
+Function Output/Parameters: none
+Function Output/Returned: decoded operation (OpDecodeCodes)
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
 */
-int calculateOpTime(OpCodeType *MDPtr, ConfigDataType *configPtr);
+OpDecodeCodes decodeOpKind( const OpCodeType *opPtr );
 
 /*
 Name: dumpFile
-Process: dumps all the lines into a file at the end
+Process: dumps all the lines into a file at the end, formatting the
+         time stamp of each timed event
 Function Input/Parameters: pointer to fileHolder head (logToFile *),
                            pointer to file (FILE *)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: none
-Dependencies: fprintf
+Dependencies: nSecToString, fprintf
 */
 void dumpFile(logToFile *fileHolder, FILE *fileName);
 
+/*
+Name: initSimRun
+Process: sets up the shared state of a simulation run, its cpus with
+         their run queues, its devices and, in pool mode, its worker pool
+Function Input/Parameters: pointer to run (SimRunType *),
+                           configuration data (ConfigDataType *),
+                           pointer to fileHolder head (logToFile *),
+                           run timer (SimTimerType *),
+                           process loader, NULL if preloaded (MetaDataStream *)
+Function Output/Parameters: initialized run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: initInterruptQueue, malloc, initReadyQueue, 
+              pthread_mutex_init, pthread_cond_init, startDevices, 
+              startWorkerPool
+*/
+void initSimRun( SimRunType *runPtr, ConfigDataType *configPtr, 
+                 logToFile *fileHolder, struct SimTimerType *simTimer, 
+                 MetaDataStream *streamPtr );
+
+/*
+Name: logEvent
+Process: displays a time stamped line to monitor and/or file by log code
+Function Input/Parameters: pointer to run (SimRunType *),
+                           line text after the time stamp (const char *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: lapSimTimer, nSecToString, printf, addEvent
+*/
+void logEvent( SimRunType *runPtr, const char *eventLine );
+
+/*
+Name: raiseInterrupt
+Process: device side; signals I/O completion of a blocked process by 
+         pushing its interrupt lock free, waking an idle cpu if any
+Function Input/Parameters: pointer to blocked PCB (PCBType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pushInterruptQueue, wakeIdleCpu
+*/
+void raiseInterrupt( PCBType *pcbPtr );
+
+/*
+Name: getOpName
+Process: sets the display name of a timed op, empty for other ops
+Function Input/Parameters: pointer to op code (const OpCodeType *),
+                           name buffer size (int)
+Function Output/Parameters: op name (char *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: snprintf, strArgCodeToString
+*/
+void getOpName( const OpCodeType *opPtr, char *opName, int nameSize );
+
+/*
+Name: markRunLoad
+Process: changes the busy cpu and device counts of a run with devices, 
+         first adding the time since the last change to cpu busy, device
+         busy and overlapped time
+Function Input/Parameters: pointer to run (SimRunType *),
+                           change in busy cpus (int),
+                           change in busy devices (int)
+Function Output/Parameters: updated load times (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, lapSimTimer, pthread_mutex_unlock
+*/
+void markRunLoad( SimRunType *runPtr, int cpuChange, int deviceChange );
+
+/*
+Name: submitDeviceRequest
+Process: queues a blocked process on the device of its I/O op, starting
+         the device worker on first use and taking the run timer for it
+         when it was idle; services the request in place if the worker
+         cannot start
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to blocked PCB (PCBType *)
+Function Output/Parameters: updated device queue (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_create, pthread_mutex_unlock,
+              serviceDeviceRequest, addSimTimerThread, pthread_cond_signal
+*/
+void submitDeviceRequest( SimRunType *runPtr, PCBType *pcbPtr );
+
+/*
+Name: simulateDevice
+Process: device worker thread; services its queue in request order,
+         gives up the run timer while the queue is empty, until stopped
+Function Input/Parameters: pointer to device (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, serviceDeviceRequest, endSimTimerThread
+*/
+void *simulateDevice( void *arg );
+
+/*
+Name: serviceDeviceRequest
+Process: runs the I/O op of a blocked process on its device, advances
+         its program counter and raises its completion interrupt
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to blocked PCB (PCBType *)
+Function Output/Parameters: updated program counter and time left
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: markRunLoad, runTimer, getOpName, logEvent, raiseInterrupt
+*/
+void serviceDeviceRequest( SimRunType *runPtr, PCBType *pcbPtr );
+
+/*
+Name: startDevices
+Process: sets up one device slot per argument code for runs whose 
+         policy blocks processes on I/O, the preemptive policies; each
+         worker starts on its first request
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: run devices, NULL if none (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: isPreemptivePolicy, malloc, pthread_mutex_init, 
+              pthread_cond_init
+*/
+void startDevices( SimRunType *runPtr );
+
+/*
+Name: endDevices
+Process: stops and joins the device workers of a run, releases devices
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: cleared run devices (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_signal, 
+              pthread_mutex_unlock, pthread_join, pthread_mutex_destroy,
+              pthread_cond_destroy, free
+*/
+void endDevices( SimRunType *runPtr );
+
+/*
+Name: runProcessBurst
+Process: runs ops of a dispatched process from its program counter, 
+         up to the end of the process, the quantum for preemptive 
+         policies, inside a cpu op if it ends there, or an I/O op when 
+         the run has devices
+Function Input/Parameters: pointer to running PCB (PCBType *)
+Function Output/Parameters: updated program counter, op cycles left,
+                            cycles left and time left
+Function Output/Returned: state to leave the cpu in, READY_STATE,
+                          BLOCKED_STATE or EXIT_STATE (int)
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: isPreemptivePolicy, getOpName, logEvent, runTimer
+*/
+int runProcessBurst( PCBType *pcbPtr );
+
 /*
 Name: runSim
 Process: primary simulation driver
@@ -125,6 +435,188 @@ Dependencies: tbd
 */
 void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr );
 
+/*
+Name: runSimStream
+Process: pipelined simulation driver, queues each process as soon as its
+         block is loaded while the rest of the metadata is still parsed
+Function Input/Parameters: configuration data (ConfigDataType *),
+                           started metadata stream (MetaDataStream *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: initSimRun, dispatchProcesses, clearSimRun, 
+              finishMetaDataStream, accessTimer
+*/
+void runSimStream( ConfigDataType *configPtr, MetaDataStream *streamPtr );
+
+/*
+Name: admitStreamProcesses
+Process: moves loaded process blocks from the stream loader into a cpu
+         run queue, waiting only when that cpu has nothing else to run;
+         one cpu admits at a time
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to admitting cpu (CpuRunType *)
+Function Output/Parameters: updated run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: getStreamProcess, pollStreamProcess, decodeMetaData,
+              indexProcess, addPCB, setState, startProcess, pushReadyQueue,
+              wakeIdleCpu
+*/
+void admitStreamProcesses( SimRunType *runPtr, CpuRunType *cpuPtr );
+
+/*
+Name: clearSimRun
+Process: stops the worker pool and devices and releases the shared 
+         state of a finished simulation run
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: cleared run (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: endWorkerPool, endDevices, clearReadyQueue, 
+              pthread_cond_destroy, free, pthread_mutex_destroy
+*/
+void clearSimRun( SimRunType *runPtr );
+
+/*
+Name: drainInterrupts
+Process: between quanta, takes each I/O completion interrupt off the 
+         run interrupt queue and sets its process ready on this cpu; 
+         one cpu drains at a time
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to draining cpu (CpuRunType *)
+Function Output/Parameters: updated run queues (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: popInterruptQueue, logEvent, pushReadyQueue
+*/
+void drainInterrupts( SimRunType *runPtr, CpuRunType *cpuPtr );
+
+/*
+Name: dispatchProcesses
+Process: runs the dispatcher of each simulated cpu, cpu 0 on the 
+         calling thread and the rest on their own threads, until no 
+         process is left, then reports cpu utilization and I/O overlap
+         for runs with devices
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: addSimTimerThread, pthread_create, endSimTimerThread,
+              dispatchCpu, pthread_join, markRunLoad, snprintf, logEvent
+*/
+void dispatchProcesses( SimRunType *runPtr );
+
+/*
+Name: dispatchCpu
+Process: scheduler loop of one cpu; runs its run queue root, or a 
+         process stolen from the busiest cpu, resumed in place as a 
+         coroutine or on the worker pool, until it yields, then re-keys 
+         it in place, or removes it at exit or to block on its device; 
+         waits idle with nothing to run, until no process is left
+Function Input/Parameters: pointer to cpu (CpuRunType *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: admitStreamProcesses, drainInterrupts, boostProcesses, 
+              selectProcess, levelReadyPCB, waitIdleCpu, logEvent, 
+              markRunLoad, runProcessBurst, pthread_cond_signal, 
+              pthread_cond_wait, requeueReadyQueue, removeReadyQueue, 
+              getOpName, submitDeviceRequest, clearMetaDataList, free
+*/
+void dispatchCpu( CpuRunType *cpuPtr );
+
+/*
+Name: boostProcesses
+Process: MLFQ priority boost; once the boost time has passed, moves 
+         every process back to level 0 on all cpus together; called with
+         runMutex held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated run queues and next boost time 
+                            (SimRunType *)
+Function Output/Returned: Boolean result, true if boosted (bool)
+Device Input/device: none
+Device Output/device: none
+Dependencies: lapSimTimer, boostReadyQueue
+*/
+bool boostProcesses( SimRunType *runPtr );
+
+/*
+Name: placeProcesses
+Process: spreads a PCB list over the cpu run queues in PID order, round
+         robin, then heapifies each queue once
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to PCB list head (PCBType *)
+Function Output/Parameters: updated run queues (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: startProcess, appendReadyQueue, heapifyReadyQueue
+*/
+void placeProcesses( SimRunType *runPtr, PCBType *headPtr );
+
+/*
+Name: selectProcess
+Process: picks the next process for a cpu, its own run queue root, or 
+         one stolen from the cpu with the most waiting; called with 
+         runMutex held
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to cpu (CpuRunType *)
+Function Output/Parameters: cpu the process came from (int *)
+Function Output/Returned: selected PCB, NULL if none (PCBType *)
+Device Input/device: none
+Device Output/device: none
+Dependencies: peekReadyQueue, popReadyQueue, stealReadyQueue, 
+              pushReadyQueue
+*/
+PCBType *selectProcess( SimRunType *runPtr, CpuRunType *cpuPtr, 
+                                                              int *fromCpu );
+
+/*
+Name: simulateCpu
+Process: dispatcher thread of a cpu past cpu 0
+Function Input/Parameters: pointer to cpu (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, dispatchCpu, endTimerThread
+*/
+void *simulateCpu( void *arg );
+
+/*
+Name: waitIdleCpu
+Process: parks a cpu with nothing to run without the run timer until 
+         it is woken for new work or the run ends; called with runMutex
+         held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated idle counts (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: endSimTimerThread, pthread_cond_wait, addSimTimerThread
+*/
+void waitIdleCpu( SimRunType *runPtr );
+
+/*
+Name: wakeIdleCpu
+Process: wakes one idle cpu, if any, taking the run timer for it; 
+         called with runMutex held
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: updated idle counts (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: addSimTimerThread, pthread_cond_signal
+*/
+void wakeIdleCpu( SimRunType *runPtr );
+
 /*
 Name: setState
 Process: loops over the PCB list setting the state and displaying appropriately
@@ -137,15 +629,15 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: Displays to monitor and/or file
-Dependencies: accessTimer
+Dependencies: currentSimTimer, lapSimTimer, nSecToString, addEvent
 */
 void setState(PCBType *headPtr, int state, int logCode,
               logToFile* fileHolder, FILE* logFile);
 
 /*
 Name: startPCB
-Process: starts building the PCB linked list
-Function Input/Parameters: pointer to metadata (OpCodeType *),
+Process: builds the PCB linked list from the process index
+Function Input/Parameters: pointer to process index (ProcessIndexTable *),
                            pointer to config data (ConfigDataType *)
 Function Output/Parameters: none
 Function Output/Returned: pointer to head of PCB linked list
@@ -153,7 +645,7 @@ Device Input/device: none
 Device Output/device: none
 Dependencies: addPCB
 */
-PCBType *startPCB(OpCodeType *metaDataPtr, ConfigDataType *configPtr);
+PCBType *startPCB( ProcessIndexTable *indexPtr, ConfigDataType *configPtr );
 
 /*
 Name: displayPCB
@@ -184,12 +676,65 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/device: none
 Device Output/device: Displays to monitor and/or file
-Dependencies: accessTimer
+Dependencies: currentSimTimer, lapSimTimer, nSecToString, printf, addEvent
 */
 void checkIdle(PCBType *PCBHeadHolder, logToFile *fileHolder, char *timer, int logCode);
 
+/*
+Name: simulateWorker
+Process: pool worker thread; takes each dispatched process as a task,
+         runs a burst of its ops, then yields it back to the dispatcher,
+         until the pool is stopped
+Function Input/Parameters: pointer to run (void *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: Displays to monitor and/or file
+Dependencies: bindSimTimer, pthread_cond_wait, runProcessBurst,
+              pthread_cond_signal
+*/
+void *simulateWorker( void *arg );
+
+/*
+Name: startProcess
+Process: binds a PCB to its run and cpu and sets it ready to dispatch,
+         the caller queues it ready
+Function Input/Parameters: pointer to run (SimRunType *),
+                           pointer to PCB (PCBType *),
+                           cpu number (int)
+Function Output/Parameters: started PCB (PCBType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: none
+*/
+void startProcess( SimRunType *runPtr, PCBType *pcbPtr, int cpuID );
+
+/*
+Name: startWorkerPool
+Process: starts the worker pool of a run, sized by the config worker
+         threads, online cores if zero, and at least one per cpu
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: started pool (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: sysconf, malloc, pthread_create
+*/
+void startWorkerPool( SimRunType *runPtr );
 
-void *simulateProcess(void *arg);
+/*
+Name: endWorkerPool
+Process: stops the worker pool of a run and joins its threads
+Function Input/Parameters: pointer to run (SimRunType *)
+Function Output/Parameters: stopped pool (SimRunType *)
+Function Output/Returned: none
+Device Input/device: none
+Device Output/device: none
+Dependencies: pthread_mutex_lock, pthread_cond_broadcast, 
+              pthread_mutex_unlock, pthread_join, free
+*/
+void endWorkerPool( SimRunType *runPtr );
 
 /*
 Name: memSim